@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/app/context.hpp>
+#include <lge/dispatcher/dispatcher.hpp>
+#include <lge/internal/null/null_backend.hpp>
+#include <lge/systems/system.hpp>
+
+#include <array>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <glm/ext/vector_float2.hpp>
+
+// =============================================================================
+// Scaling
+// =============================================================================
+
+// entity counts scaling benchmarks run at, e.g. GENERATE(from_range(entity_counts))
+inline constexpr std::array<std::size_t, 4> entity_counts{100, 1'000, 10'000, 100'000};
+
+// position of the i-th entity on a square grid with one entity every spacing units
+[[nodiscard]] inline auto grid_position(const std::size_t i, const float spacing = 20.F) -> glm::vec2 {
+	constexpr std::size_t columns = 320;
+	return {static_cast<float>(i % columns) * spacing, static_cast<float>(i / columns) * spacing};
+}
+
+// =============================================================================
+// Shared benchmark fixtures
+// =============================================================================
+
+// Backend, dispatcher and registry wired into a context, without any system.
+struct bench_world {
+	lge::backend backend{lge::null_backend::create()};
+	lge::dispatcher dispatcher{};
+	entt::registry world{};
+	lge::context ctx{
+		.render = *backend.renderer_ptr,
+		.actions = *backend.input_ptr,
+		.resources = *backend.resource_manager_ptr,
+		.audio = *backend.audio_manager_ptr,
+		.world = world,
+		.events = dispatcher,
+	};
+};
+
+// World plus a single system under measurement.
+// System_T must be constructible as: System_T{lge::phase, lge::context&}.
+template<typename System_T>
+struct bench_fixture: bench_world {
+	System_T system{lge::phase::global_update, ctx};
+};
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/placement.hpp>
+#include <lge/internal/components/metrics.hpp>
+#include <lge/internal/systems/bounds_system.hpp>
+#include <lge/internal/systems/transform_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <string>
+
+TEST_CASE("bounds_system: scaling", "[benchmark][bounds]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	bench_fixture<lge::bounds_system> f;
+	lge::transform_system transforms{lge::phase::global_update, f.ctx};
+	for(std::size_t i = 0; i < count; ++i) {
+		const auto e = f.world.create();
+		const auto position = grid_position(i);
+		f.world.emplace<lge::placement>(e, lge::placement{position.x, position.y, static_cast<float>(i % 360)});
+		f.world.emplace<lge::metrics>(e, lge::metrics{{16.F, 16.F}});
+	}
+	REQUIRE(!transforms.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " rotated entities") {
+		return f.system.update(0.F);
+	};
+}
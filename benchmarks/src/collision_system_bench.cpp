@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/collidable.hpp>
+#include <lge/components/placement.hpp>
+#include <lge/internal/components/bounds.hpp>
+#include <lge/internal/components/metrics.hpp>
+#include <lge/internal/systems/bounds_system.hpp>
+#include <lge/internal/systems/collision_system.hpp>
+#include <lge/internal/systems/transform_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr auto box_size = 16.F;
+// average distance between boxes, keeps the density (and overlaps per box) constant at any scale
+constexpr auto spacing = 40.F;
+
+struct collision_fixture: bench_world {
+	lge::transform_system transforms{lge::phase::global_update, ctx};
+	lge::bounds_system bounds{lge::phase::global_update, ctx};
+	lge::collision_system collisions{lge::phase::global_update, ctx};
+
+	explicit collision_fixture(const std::size_t count) {
+		const auto side = std::sqrt(static_cast<float>(count)) * spacing;
+		std::mt19937 rng{42};
+		std::uniform_real_distribution<float> coord{0.F, side};
+		std::uniform_real_distribution<float> angle{0.F, 360.F};
+
+		for(std::size_t i = 0; i < count; ++i) {
+			const auto e = world.create();
+			world.emplace<lge::placement>(e, lge::placement{coord(rng), coord(rng), angle(rng)});
+			world.emplace<lge::metrics>(e, lge::metrics{{box_size, box_size}});
+			world.emplace<lge::collidable>(e);
+		}
+
+		REQUIRE(!transforms.update(0.F).has_error());
+		REQUIRE(!bounds.update(0.F).has_error());
+		REQUIRE(!collisions.update(0.F).has_error());
+	}
+
+	// puts every entity but one in a hundred on a layer that never collides with itself
+	auto split_into_teams() -> void {
+		constexpr std::uint32_t bullets = 1U << 1U;
+		constexpr std::uint32_t targets = 1U << 2U;
+		std::size_t index = 0;
+		for(auto [entity, col]: world.view<lge::collidable>().each()) {
+			col = index++ % 100 == 0 ? lge::collidable{.layer = targets, .mask = bullets}
+									 : lge::collidable{.layer = bullets, .mask = targets};
+		}
+		REQUIRE(!collisions.update(0.F).has_error());
+	}
+
+	// shifts every tenth box directly in world space, skipping the transform and bounds cost
+	auto move_some() -> void {
+		std::size_t index = 0;
+		for(auto [entity, b]: world.view<lge::bounds>().each()) {
+			if(index++ % 10 != 0) {
+				continue;
+			}
+			const auto offset = glm::vec2{3.F, 0.F};
+			b.p0 += offset;
+			b.p1 += offset;
+			b.p2 += offset;
+			b.p3 += offset;
+		}
+	}
+};
+
+} // namespace
+
+TEST_CASE("collision_system: broadphase scaling", "[benchmark][collision]") {
+	const auto count = GENERATE(from_range(entity_counts));
+	collision_fixture f{count};
+
+	BENCHMARK(std::to_string(count) + " static collidables") {
+		return f.collisions.update(0.F);
+	};
+
+	BENCHMARK(std::to_string(count) + " collidables, 10% moving") {
+		f.move_some();
+		return f.collisions.update(0.F);
+	};
+}
+
+TEST_CASE("collision_system: same-team projectiles", "[benchmark][collision]") {
+	const auto count = GENERATE(std::size_t{10'000}, std::size_t{50'000});
+	collision_fixture f{count};
+	f.split_into_teams();
+
+	BENCHMARK(std::to_string(count) + " collidables, 1% targets") {
+		return f.collisions.update(0.F);
+	};
+}
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/result.hpp>
+#include <lge/dispatcher/dispatcher.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <tuple>
+
+namespace {
+
+struct bench_event {
+	std::size_t value;
+};
+
+} // namespace
+
+TEST_CASE("dispatcher: post", "[benchmark][dispatcher]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	lge::dispatcher dispatcher;
+	std::size_t sum = 0;
+	std::ignore = dispatcher.subscribe<bench_event>([&sum](const bench_event &e) -> lge::result<> {
+		sum += e.value;
+		return true;
+	});
+
+	BENCHMARK(std::to_string(count) + " events, one subscriber") {
+		for(std::size_t i = 0; i < count; ++i) {
+			if(const auto err = dispatcher.post(bench_event{.value = i}).unwrap(); err) [[unlikely]] {
+				return sum;
+			}
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("dispatcher: post to many subscribers", "[benchmark][dispatcher]") {
+	const auto subscribers = GENERATE(as<std::size_t>{}, 1, 10, 100);
+
+	lge::dispatcher dispatcher;
+	std::size_t sum = 0;
+	for(std::size_t i = 0; i < subscribers; ++i) {
+		std::ignore = dispatcher.subscribe<bench_event>([&sum, i](const bench_event &e) -> lge::result<> {
+			sum += e.value + i;
+			return true;
+		});
+	}
+
+	BENCHMARK(std::to_string(subscribers) + " subscribers") {
+		if(const auto err = dispatcher.post(bench_event{.value = 1}).unwrap(); err) [[unlikely]] {
+			return sum;
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("dispatcher: enqueue and drain", "[benchmark][dispatcher]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	lge::dispatcher dispatcher;
+	std::size_t sum = 0;
+	std::ignore =
+		dispatcher.subscribe_batch<bench_event>([&sum](const std::span<const bench_event> events) -> lge::result<> {
+			for(const auto &e: events) {
+				sum += e.value;
+			}
+			return true;
+		});
+
+	BENCHMARK(std::to_string(count) + " events, one batch subscriber") {
+		for(std::size_t i = 0; i < count; ++i) {
+			dispatcher.enqueue(bench_event{.value = i});
+		}
+		if(const auto err = dispatcher.drain().unwrap(); err) [[unlikely]] {
+			return sum;
+		}
+		return sum;
+	};
+}
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/hidden.hpp>
+#include <lge/components/hierarchy.hpp>
+#include <lge/internal/systems/hidden_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <string>
+
+namespace {
+
+constexpr std::size_t children_per_root = 4;
+constexpr std::size_t hidden_every = 10;
+
+// roots with children_per_root children each, one root in hidden_every hidden
+auto add_tree(entt::registry &world, const std::size_t count) -> void {
+	for(std::size_t i = 0; i < count; i += children_per_root + 1) {
+		const auto root = world.create();
+		if((i / (children_per_root + 1)) % hidden_every == 0) {
+			world.emplace<lge::hidden>(root);
+		}
+		for(std::size_t j = 0; j < children_per_root; ++j) {
+			lge::attach(world, root, world.create());
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("hidden_system: scaling", "[benchmark][hidden]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	bench_fixture<lge::hidden_system> f;
+	add_tree(f.world, count);
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " entities, 10% of trees hidden") {
+		return f.system.update(0.F);
+	};
+}
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/label.hpp>
+#include <lge/components/shapes.hpp>
+#include <lge/internal/systems/metrics_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <string>
+
+TEST_CASE("metrics_system: scaling", "[benchmark][metrics]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	bench_fixture<lge::metrics_system> f;
+	for(std::size_t i = 0; i < count; ++i) {
+		const auto e = f.world.create();
+		if(i % 2 == 0) {
+			f.world.emplace<lge::rect>(e, lge::rect{.size = {16.F, 16.F}});
+		} else {
+			f.world.emplace<lge::label>(e, lge::label{.text = "score: " + std::to_string(i)});
+		}
+	}
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " shapes and labels, idle") {
+		return f.system.update(0.F);
+	};
+
+	// every label changes size, so each one is measured again
+	auto grow = false;
+	BENCHMARK(std::to_string(count) + " shapes and labels, labels changed") {
+		grow = !grow;
+		for(auto &&[entity, lbl]: f.world.view<lge::label>().each()) {
+			lbl.size = grow ? 18.F : 17.F;
+		}
+		return f.system.update(0.F);
+	};
+}
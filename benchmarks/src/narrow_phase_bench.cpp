@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/internal/collision/narrow_phase.hpp>
+#include <lge/internal/components/bounds.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <glm/ext/vector_float2.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t quad_count = 1'024;
+
+// random rotated rectangles packed tightly enough that roughly half of the pairs overlap
+auto make_quads() -> std::vector<lge::bounds> {
+	std::mt19937 rng{42};
+	std::uniform_real_distribution<float> position{0.F, 64.F};
+	std::uniform_real_distribution<float> half_size{4.F, 16.F};
+	std::uniform_real_distribution<float> angle{0.F, 6.2831853F};
+
+	std::vector<lge::bounds> quads;
+	quads.reserve(quad_count);
+	for(std::size_t i = 0; i < quad_count; ++i) {
+		const auto center = glm::vec2{position(rng), position(rng)};
+		const auto half = glm::vec2{half_size(rng), half_size(rng)};
+		const auto c = std::cos(angle(rng));
+		const auto s = std::sin(angle(rng));
+		const auto corner = [&](const float x, const float y) -> glm::vec2 {
+			return center + glm::vec2{(c * x) - (s * y), (s * x) + (c * y)};
+		};
+		quads.push_back({corner(-half.x, -half.y), corner(half.x, -half.y), corner(half.x, half.y),
+						 corner(-half.x, half.y)});
+	}
+	return quads;
+}
+
+} // namespace
+
+// every quad against the next 16, the typical candidate count of a busy grid cell
+TEST_CASE("narrow_phase: quad against 16 candidates", "[benchmark][collision]") {
+	constexpr std::size_t candidates = 16;
+	const auto quads = make_quads();
+
+	std::vector<std::uint8_t> hits(candidates);
+
+	BENCHMARK("triangulated") {
+		std::size_t overlaps = 0;
+		for(std::size_t i = 0; i + candidates < quads.size(); ++i) {
+			for(std::size_t j = 1; j <= candidates; ++j) {
+				overlaps += lge::quads_overlap_triangulated(quads[i], quads[i + j]) ? 1 : 0;
+			}
+		}
+		return overlaps;
+	};
+
+	BENCHMARK("oriented quads, scalar") {
+		std::size_t overlaps = 0;
+		for(std::size_t i = 0; i + candidates < quads.size(); ++i) {
+			for(std::size_t j = 1; j <= candidates; ++j) {
+				overlaps += lge::quads_overlap(quads[i], quads[i + j]) ? 1 : 0;
+			}
+		}
+		return overlaps;
+	};
+
+	// includes filling the structure-of-arrays batch, as collision_system does per entity
+	BENCHMARK("oriented quads, batched") {
+		std::size_t overlaps = 0;
+		lge::quad_batch window;
+		for(std::size_t i = 0; i + candidates < quads.size(); ++i) {
+			window.clear();
+			for(std::size_t j = 1; j <= candidates; ++j) {
+				window.push(quads[i + j]);
+			}
+			lge::quads_overlap_batch(quads[i], window, hits);
+			for(const auto hit: hits) {
+				overlaps += hit;
+			}
+		}
+		return overlaps;
+	};
+}
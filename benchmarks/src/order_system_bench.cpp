@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/hierarchy.hpp>
+#include <lge/components/order.hpp>
+#include <lge/internal/systems/order_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <string>
+
+namespace {
+
+constexpr std::size_t children_per_root = 4;
+
+// roots with an order and children_per_root children each, every other child overriding its index
+auto add_ordered_tree(entt::registry &world, const std::size_t count) -> void {
+	for(std::size_t i = 0; i < count; i += children_per_root + 1) {
+		const auto root = world.create();
+		world.emplace<lge::order>(root, lge::order{.layer = static_cast<int>(i % 8), .index = 0});
+		for(std::size_t j = 0; j < children_per_root; ++j) {
+			const auto child = world.create();
+			if(j % 2 == 0) {
+				world.emplace<lge::order>(child, lge::order{.layer = 0, .index = static_cast<int>(j)});
+			}
+			lge::attach(world, root, child);
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("order_system: scaling", "[benchmark][order]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	bench_fixture<lge::order_system> f;
+	add_ordered_tree(f.world, count);
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " entities in trees of 5") {
+		return f.system.update(0.F);
+	};
+}
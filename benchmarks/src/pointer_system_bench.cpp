@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/clickable.hpp>
+#include <lge/internal/components/bounds.hpp>
+#include <lge/internal/systems/pointer_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <string>
+
+TEST_CASE("pointer_system: scaling", "[benchmark][pointer]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	// clickable 16x16 quads on a grid, the mouse rests over the first one
+	bench_fixture<lge::pointer_system> f;
+	for(std::size_t i = 0; i < count; ++i) {
+		const auto e = f.world.create();
+		const auto p = grid_position(i);
+		f.world.emplace<lge::clickable>(e);
+		f.world.emplace<lge::bounds>(e,
+									 lge::bounds{
+										 .p0 = {p.x - 8.F, p.y - 8.F},
+										 .p1 = {p.x + 8.F, p.y - 8.F},
+										 .p2 = {p.x + 8.F, p.y + 8.F},
+										 .p3 = {p.x - 8.F, p.y + 8.F},
+									 });
+	}
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " clickables") {
+		return f.system.update(0.F);
+	};
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/app/app_config.hpp>
+#include <lge/components/label.hpp>
+#include <lge/components/order.hpp>
+#include <lge/components/placement.hpp>
+#include <lge/components/shapes.hpp>
+#include <lge/core/result.hpp>
+#include <lge/internal/systems/metrics_system.hpp>
+#include <lge/internal/systems/order_system.hpp>
+#include <lge/internal/systems/render_system.hpp>
+#include <lge/internal/systems/transform_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <string>
+
+namespace {
+
+constexpr int layers = 4;
+
+// rects, circles and labels spread over a few layers, with transforms, metrics and order resolved
+auto add_drawables(bench_world &w, const std::size_t count) -> void {
+	for(std::size_t i = 0; i < count; ++i) {
+		const auto e = w.world.create();
+		const auto p = grid_position(i);
+		w.world.emplace<lge::placement>(e, lge::placement{p.x, p.y});
+		w.world.emplace<lge::order>(e, lge::order{.layer = static_cast<int>(i) % layers, .index = 0});
+		switch(i % 3) {
+		case 0:
+			w.world.emplace<lge::rect>(e, lge::rect{.size = {16.F, 16.F}});
+			break;
+		case 1:
+			w.world.emplace<lge::circle>(e, lge::circle{.radius = 8.F});
+			break;
+		default:
+			w.world.emplace<lge::label>(e, lge::label{.text = "label " + std::to_string(i)});
+			break;
+		}
+	}
+
+	lge::transform_system transforms{lge::phase::global_update, w.ctx};
+	lge::order_system orders{lge::phase::global_update, w.ctx};
+	lge::metrics_system metrics{lge::phase::global_update, w.ctx};
+	REQUIRE(!transforms.update(0.F).has_error());
+	REQUIRE(!orders.update(0.F).has_error());
+	REQUIRE(!metrics.update(0.F).has_error());
+}
+
+} // namespace
+
+// draws are submitted to the null backend's recording renderer, so this measures the engine side only
+TEST_CASE("render_system: scaling", "[benchmark][render]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	bench_fixture<lge::render_system> f;
+	REQUIRE(!f.backend.renderer_ptr->init(lge::app_config{}).has_error());
+	add_drawables(f, count);
+
+	BENCHMARK(std::to_string(count) + " shapes and labels on 4 layers") {
+		// begin_frame drops the draws recorded by the previous iteration
+		if(const auto err = f.backend.renderer_ptr->begin_frame().unwrap(); err) [[unlikely]] {
+			return lge::result<>{*err};
+		}
+		return f.system.update(0.F);
+	};
+}
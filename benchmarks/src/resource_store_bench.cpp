@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/resource_manager/resource_store.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// resource that loads from nothing, so only the store itself is measured
+struct bench_resource {
+	[[nodiscard]] auto load(std::string_view /*uri*/) -> lge::result<> {
+		return true;
+	}
+
+	std::size_t payload = 1;
+};
+
+using bench_store = lge::resource_store<bench_resource, lge::texture_handle>;
+
+} // namespace
+
+TEST_CASE("resource_store: lookups", "[benchmark][resource_store]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	bench_store store;
+	std::vector<lge::texture_handle> handles;
+	handles.reserve(count);
+	for(std::size_t i = 0; i < count; ++i) {
+		lge::texture_handle handle;
+		REQUIRE(!store.load("texture_" + std::to_string(i) + ".png").unwrap(handle).has_value());
+		handles.push_back(handle);
+	}
+
+	// the const lookup the renderer does for every texture, font and sound
+	const auto &lookup = store;
+	BENCHMARK(std::to_string(count) + " lookups in a store of " + std::to_string(count)) {
+		std::size_t total = 0;
+		for(const auto handle: handles) {
+			const bench_resource *resource = nullptr;
+			if(const auto err = lookup.get(handle).unwrap(resource); !err) [[likely]] {
+				total += resource->payload;
+			}
+		}
+		return total;
+	};
+}
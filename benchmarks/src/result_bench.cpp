@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/core/hashed_string.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+// a clip as animation_system looks it up for every animated entity, every frame
+auto make_clip() -> lge::animation_library_anim {
+	lge::animation_library_anim clip{.frames = {}, .fps = 12.F};
+	for(std::size_t i = 0; i < 16; ++i) {
+		clip.frames.emplace_back("frame");
+	}
+	return clip;
+}
+
+// how get_animation returned clips before, a copy of the frames for every call
+auto clip_by_value(const lge::animation_library_anim &clip) -> lge::result<lge::animation_library_anim> {
+	return clip;
+}
+
+auto clip_by_pointer(const lge::animation_library_anim &clip) -> lge::result<const lge::animation_library_anim *> {
+	return &clip;
+}
+
+auto fail_through(const std::size_t depth) -> lge::result<> {
+	if(depth == 0) {
+		return lge::error("resource not found");
+	}
+	if(const auto err = fail_through(depth - 1).unwrap(); err) [[unlikely]] {
+		return lge::error("failed to load", *err);
+	}
+	return true;
+}
+
+} // namespace
+
+TEST_CASE("result: animation clip lookups", "[benchmark][result]") {
+	const auto count = GENERATE(from_range(entity_counts));
+	const auto clip = make_clip();
+
+	BENCHMARK(std::to_string(count) + " clips by value") {
+		std::size_t frames = 0;
+		for(std::size_t i = 0; i < count; ++i) {
+			lge::animation_library_anim found{};
+			if(const auto err = clip_by_value(clip).unwrap(found); !err) [[likely]] {
+				frames += found.frames.size();
+			}
+		}
+		return frames;
+	};
+
+	BENCHMARK(std::to_string(count) + " clips by pointer") {
+		std::size_t frames = 0;
+		for(std::size_t i = 0; i < count; ++i) {
+			const lge::animation_library_anim *found = nullptr;
+			if(const auto err = clip_by_pointer(clip).unwrap(found); !err) [[likely]] {
+				frames += found->frames.size();
+			}
+		}
+		return frames;
+	};
+}
+
+TEST_CASE("result: error propagation", "[benchmark][result]") {
+	const auto depth = GENERATE(as<std::size_t>{}, 1, 10, 100);
+
+	BENCHMARK(std::to_string(depth) + " levels") {
+		return fail_through(depth).has_error();
+	};
+}
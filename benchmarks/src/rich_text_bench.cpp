@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/colors.hpp>
+#include <lge/internal/text/rich_text.hpp>
+#include <lge/text/text_segment.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// labels alternating plain text with colored and reset tags
+auto make_labels(const std::size_t count) -> std::vector<std::string> {
+	std::vector<std::string> labels;
+	labels.reserve(count);
+	for(std::size_t i = 0; i < count; ++i) {
+		labels.push_back("score {#FFD700}" + std::to_string(i) + "{#} lives {#FF000080}3{#}");
+	}
+	return labels;
+}
+
+// dialog text of about size bytes, a tag every few words as a colored name or value would have
+auto make_dialog(const std::size_t size) -> std::string {
+	std::string text;
+	text.reserve(size + 64);
+	for(std::size_t i = 0; text.size() < size; ++i) {
+		text += "the {#FFD700}knight{#} said ";
+		text += std::to_string(i);
+		text += i % 3 == 0 ? " {#FF000080}twice{#}, " : " once, ";
+	}
+	return text;
+}
+
+// how parse_rich_text worked when segments owned their text: one append per char, one string per segment
+struct owned_segment {
+	std::string text;
+	lge::color segment_color;
+};
+
+auto parse_copying(const std::string_view text, const lge::color &default_color) -> std::vector<owned_segment> {
+	std::vector<owned_segment> segments;
+	auto current_color = default_color;
+	std::string current;
+	current.reserve(text.size());
+
+	std::size_t i = 0;
+	lge::rich_tag tag{};
+	while(i < text.size()) {
+		if(text[i] == '{' && lge::find_rich_tag(text, i, default_color, tag) && tag.begin == i) {
+			if(!current.empty()) {
+				segments.push_back({current, current_color});
+				current.clear();
+				current.reserve(text.size() - tag.end);
+			}
+			current_color = tag.tag_color;
+			i = tag.end;
+			continue;
+		}
+		current += text[i];
+		++i;
+	}
+	if(!current.empty()) {
+		segments.push_back({current, current_color});
+	}
+	return segments;
+}
+
+constexpr std::array<std::size_t, 4> dialog_sizes{1'024, 2'048, 5'120, 10'240};
+
+} // namespace
+
+TEST_CASE("rich_text: parse", "[benchmark][rich_text]") {
+	const auto count = GENERATE(from_range(entity_counts));
+	const auto labels = make_labels(count);
+
+	BENCHMARK(std::to_string(count) + " labels with 4 tags") {
+		std::size_t segments = 0;
+		for(const auto &text: labels) {
+			segments += lge::parse_rich_text(text, lge::colors::white).size();
+		}
+		return segments;
+	};
+}
+
+TEST_CASE("rich_text: long text throughput", "[benchmark][rich_text]") {
+	const auto size = GENERATE(from_range(dialog_sizes));
+	const auto text = make_dialog(size);
+	const auto label = std::to_string(text.size()) + " bytes";
+
+	BENCHMARK("copying parse, " + label) {
+		return parse_copying(text, lge::colors::white).size();
+	};
+
+	BENCHMARK("view parse, " + label) {
+		return lge::parse_rich_text(text, lge::colors::white).size();
+	};
+
+	std::vector<lge::text_segment> segments;
+	BENCHMARK("view parse into a reused vector, " + label) {
+		lge::parse_rich_text(text, lge::colors::white, segments);
+		return segments.size();
+	};
+
+	BENCHMARK("strip_rich_tags, " + label) {
+		return lge::strip_rich_tags(text).size();
+	};
+
+	BENCHMARK("stripped_length, " + label) {
+		return lge::stripped_length(text);
+	};
+}
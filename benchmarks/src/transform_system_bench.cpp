@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/hierarchy.hpp>
+#include <lge/components/placement.hpp>
+#include <lge/internal/components/metrics.hpp>
+#include <lge/internal/scheduler/thread_pool.hpp>
+#include <lge/internal/systems/transform_system.hpp>
+
+#include "bench_helpers.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t static_roots = 2'000;
+constexpr std::size_t children_per_root = 4;
+constexpr std::size_t moving_roots = 100;
+
+using fixture = bench_fixture<lge::transform_system>;
+
+auto add_node(entt::registry &world, const float x, const float y) -> entt::entity {
+	const auto e = world.create();
+	world.emplace<lge::placement>(e, lge::placement{x, y});
+	world.emplace<lge::metrics>(e, lge::metrics{{16.F, 16.F}});
+	return e;
+}
+
+// roots with children_per_root children each, 10k entities in total
+auto add_static_scene(entt::registry &world) -> void {
+	for(std::size_t i = 0; i < static_roots; ++i) {
+		const auto root = add_node(world, static_cast<float>(i), 0.F);
+		for(std::size_t j = 0; j < children_per_root; ++j) {
+			lge::attach(world, root, add_node(world, static_cast<float>(j), 8.F));
+		}
+	}
+}
+
+auto add_moving_roots(entt::registry &world) -> std::vector<entt::entity> {
+	std::vector<entt::entity> moving;
+	moving.reserve(moving_roots);
+	for(std::size_t i = 0; i < moving_roots; ++i) {
+		moving.push_back(add_node(world, static_cast<float>(i), 100.F));
+	}
+	return moving;
+}
+
+auto move(entt::registry &world, const auto &entities) -> void {
+	for(const auto entity: entities) {
+		world.get<lge::placement>(entity).position.x += 1.F;
+	}
+}
+
+} // namespace
+
+TEST_CASE("transform_system: 10k static and 100 moving entities", "[benchmark][transform]") {
+	fixture f;
+	add_static_scene(f.world);
+	const auto moving = add_moving_roots(f.world);
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	// every placement changes: the cost of recomposing the whole scene each frame
+	BENCHMARK("all entities moving") {
+		move(f.world, f.world.view<lge::placement>());
+		return f.system.update(0.F);
+	};
+
+	BENCHMARK("100 moving roots") {
+		move(f.world, moving);
+		return f.system.update(0.F);
+	};
+
+	BENCHMARK("idle frame") {
+		return f.system.update(0.F);
+	};
+}
+
+TEST_CASE("transform_system: scaling", "[benchmark][transform]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	fixture f;
+	for(std::size_t i = 0; i < count; ++i) {
+		const auto p = grid_position(i);
+		add_node(f.world, p.x, p.y);
+	}
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " entities, all moving") {
+		move(f.world, f.world.view<lge::placement>());
+		return f.system.update(0.F);
+	};
+}
+
+TEST_CASE("transform_system: parallel scaling", "[benchmark][transform][parallel]") {
+	const auto count = GENERATE(from_range(entity_counts));
+
+	fixture f;
+	const auto &pool = f.world.ctx().emplace<lge::thread_pool>(std::max(std::thread::hardware_concurrency(), 2U) - 1);
+	for(std::size_t i = 0; i < count; ++i) {
+		const auto p = grid_position(i);
+		const auto root = add_node(f.world, p.x, p.y);
+		if(i % children_per_root == 0) {
+			lge::attach(f.world, root, add_node(f.world, 0.F, 8.F));
+		}
+	}
+	REQUIRE(!f.system.update(0.F).has_error());
+
+	BENCHMARK(std::to_string(count) + " roots, all moving, " + std::to_string(pool.workers() + 1) + " threads") {
+		move(f.world, f.world.view<lge::placement>());
+		return f.system.update(0.F);
+	};
+}
@@ -6,6 +6,7 @@
 #include <lge/app/app_config.hpp>
 #include <lge/app/context.hpp>
 #include <lge/core/log.hpp>
+#include <lge/core/profiler.hpp>
 #include <lge/core/result.hpp>
 #include <lge/core/types.hpp>
 #include <lge/dispatcher/dispatcher.hpp>
@@ -16,17 +17,26 @@
 #include <lge/scene/scene_manager.hpp>
 #include <lge/systems/system.hpp>
 
+#include <array>
+#include <cstddef>
 #include <entity/fwd.hpp>
 #include <entt/entt.hpp>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace lge {
 
+class thread_pool;
+class system_scheduler;
+
 class app {
 public:
 	explicit app();
-	virtual ~app() = default;
+	// runs on the given backend instead of raylib, e.g. a null backend for headless tests and benchmarks
+	explicit app(backend backend);
+	virtual ~app();
 
 	app(const app &) = delete;
 	app(app &&) = delete;
@@ -34,6 +44,8 @@ public:
 	auto operator=(app &&) -> app & = delete;
 
 	[[nodiscard]] auto run() -> result<>;
+	// init, then exactly frames iterations of the main loop and end, regardless of should_close
+	[[nodiscard]] auto run_for(std::size_t frames) -> result<>;
 
 	[[nodiscard]] virtual auto configure() -> app_config {
 		return app_config{};
@@ -62,6 +74,8 @@ protected:
 		}
 		const auto type_name = get_type_name<T>();
 		systems_.push_back(std::move(system));
+		system_names_.push_back(profiler_->intern(type_name));
+		schedule_dirty_ = true;
 		log::debug("system of type `{}` registered", type_name);
 		return true;
 	}
@@ -76,6 +90,16 @@ protected:
 #endif
 	}
 
+	// update, game_update and scenes steps run in the last rendered frame, 1 without a fixed timestep
+	[[nodiscard]] auto simulation_steps() const noexcept -> std::size_t {
+		return steps_;
+	}
+
+	// per system frame timings, e.g. profiling().export_chrome_trace("trace.json")
+	[[nodiscard]] auto profiling() const noexcept -> const profiler & {
+		return *profiler_;
+	}
+
 private:
 	// =============================================================================
 	// Core state
@@ -102,6 +126,44 @@ private:
 
 	std::vector<std::unique_ptr<system>> systems_;
 
+	// =============================================================================
+	// Scheduling
+	// =============================================================================
+
+	std::unique_ptr<system_scheduler> scheduler_;
+	thread_pool *pool_ = nullptr; // owned by the registry context, null when systems run one after the other
+	std::vector<std::optional<error>> batch_errors_;
+	bool schedule_dirty_ = true;
+
+	// =============================================================================
+	// Profiling
+	// =============================================================================
+
+	struct frame_profile_names {
+		profiler::name_id frame;
+		profiler::name_id begin_frame;
+		profiler::name_id end_frame;
+		profiler::name_id update_music;
+		profiler::name_id loads;
+		profiler::name_id scenes;
+		profiler::name_id events;
+		std::array<profiler::name_id, 5> phases; // indexed by phase
+	};
+
+	profiler *profiler_ = nullptr; // owned by the registry context
+	frame_profile_names profile_names_{};
+	std::vector<profiler::name_id> system_names_; // parallel to systems_
+
+	// =============================================================================
+	// Frame pacing
+	// =============================================================================
+
+	float fixed_timestep_ = 0.F;
+	std::size_t max_steps_ = 0;
+	float accumulator_ = 0.F;
+	std::size_t steps_ = 0;
+	std::size_t max_loads_ = 1; // asynchronous loads finished per frame
+
 #ifndef __EMSCRIPTEN__
 	bool should_exit_ = false;
 #endif
@@ -111,7 +173,11 @@ private:
 	// =============================================================================
 
 	[[nodiscard]] auto main_loop() -> result<>;
-	[[nodiscard]] auto update_system(phase p, float dt) const -> result<>;
+	[[nodiscard]] auto simulate(float frame_time) -> result<>;
+	[[nodiscard]] auto step(float dt) -> result<>;
+	[[nodiscard]] auto drain_events() -> result<>;
+	[[nodiscard]] auto update_system(phase p, float dt) -> result<>;
+	[[nodiscard]] auto update_batch(std::span<const std::size_t> batch, float dt) -> result<>;
 };
 
 } // namespace lge
\ No newline at end of file
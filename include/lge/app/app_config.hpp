@@ -4,7 +4,9 @@
 #pragma once
 
 #include <lge/core/colors.hpp>
+#include <lge/core/profiler.hpp>
 
+#include <cstddef>
 #include <glm/ext/vector_float2.hpp>
 #include <string>
 
@@ -16,6 +18,22 @@ struct app_config {
 	std::string window_title{"LGE Game"};
 	std::string window_icon_path;
 	bool resizable_window{false};
+	float collision_cell_size{64.F};
+
+	// frame pacing, target_fps 0 without vsync runs uncapped, e.g. for benchmarks; browsers always pace to the display
+	int target_fps{60};
+	bool vsync{false};
+	// seconds per update, game_update and scenes step, 0 steps once per rendered frame with the frame time
+	float fixed_timestep{0.F};
+	// steps a long frame may catch up on, the time left after them is dropped
+	std::size_t max_steps_per_frame{5};
+
+	std::size_t profiler_frames{profiler::default_frames}; // frames of timing history, 0 disables the profiler
+	bool parallel_systems{false}; // systems with disjoint declared access run at the same time, ignored on the web
+	std::size_t worker_threads{0}; // threads besides the main one, 0 uses one less than the hardware threads
+
+	// asynchronous loads finished per frame, each one e.g. a texture upload, so a batch never stalls a frame
+	std::size_t max_loads_per_frame{4};
 };
 
 } // namespace lge
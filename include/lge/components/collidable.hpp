@@ -3,8 +3,17 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace lge {
 
-struct collidable {};
+// opts an entity into collision detection; two collidables are tested only when each one's mask contains a layer of
+// the other
+struct collidable {
+	static constexpr std::uint32_t all_layers = 0xFFFFFFFFU;
+
+	std::uint32_t layer{1U};
+	std::uint32_t mask{all_layers};
+};
 
 } // namespace lge
\ No newline at end of file
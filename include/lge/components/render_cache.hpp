@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+namespace lge {
+
+// draws the entity and its children once into an off-screen texture and then that texture as a single quad,
+// until anything drawn in it changes; moving the whole subtree moves the texture without drawing it again. It
+// draws at the layer and index of its first entity, clipped to the metrics of its entities, so it suits HUD and
+// dialogs whose contents rarely change
+struct render_cache {};
+
+} // namespace lge
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/result.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Profiler
+//
+// Wall time samples of the last N frames, kept in a fixed ring that recording
+// never locks or allocates in. Each slot is guarded by a sequence number, so a
+// snapshot taken while samples are being written skips the slots in flight
+// instead of reading them torn.
+// =============================================================================
+
+class profiler {
+public:
+	using name_id = std::uint16_t;
+
+	enum class category : std::uint8_t {
+		frame,
+		phase,
+		system,
+		backend,
+	};
+
+	struct sample {
+		name_id name;
+		category kind;
+		std::uint32_t frame;
+		std::uint8_t thread; // in the order threads first recorded, the main thread is usually 0
+		std::uint64_t start_ns; // since the profiler was created
+		std::uint64_t duration_ns;
+	};
+
+	static constexpr std::size_t default_frames = 120;
+	// room reserved per frame, busier frames just keep fewer frames of history
+	static constexpr std::size_t samples_per_frame = 64;
+
+	explicit profiler(std::size_t frames = default_frames);
+
+	profiler(const profiler &) = delete;
+	profiler(profiler &&) = delete;
+	auto operator=(const profiler &) -> profiler & = delete;
+	auto operator=(profiler &&) -> profiler & = delete;
+	~profiler() = default;
+
+	// drops the history, 0 frames disables recording
+	auto set_frame_capacity(std::size_t frames) -> void;
+
+	[[nodiscard]] auto frame_capacity() const noexcept -> std::size_t {
+		return frames_;
+	}
+
+	[[nodiscard]] auto is_enabled() const noexcept -> bool {
+		return frames_ != 0;
+	}
+
+	// names are registered up front, while systems register, not while recording
+	[[nodiscard]] auto intern(std::string_view name) -> name_id;
+	[[nodiscard]] auto name_of(name_id id) const -> std::string_view;
+
+	auto begin_frame() noexcept -> void {
+		frame_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] auto current_frame() const noexcept -> std::uint32_t {
+		return frame_.load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] static auto now() noexcept -> std::uint64_t;
+
+	auto record(name_id name, category kind, std::uint64_t start_ns, std::uint64_t end_ns) noexcept -> void;
+
+	// records the time from construction to destruction
+	class scope {
+	public:
+		scope(profiler *owner, const name_id name, const category kind) noexcept
+			: owner_{owner != nullptr && owner->is_enabled() ? owner : nullptr}, name_{name}, kind_{kind},
+			  start_{owner_ != nullptr ? now() : 0} {}
+
+		~scope() {
+			if(owner_ != nullptr) {
+				owner_->record(name_, kind_, start_, now());
+			}
+		}
+
+		scope(const scope &) = delete;
+		scope(scope &&) = delete;
+		auto operator=(const scope &) -> scope & = delete;
+		auto operator=(scope &&) -> scope & = delete;
+
+	private:
+		profiler *owner_;
+		name_id name_;
+		category kind_;
+		std::uint64_t start_;
+	};
+
+	// samples of the last frame_capacity() frames, oldest first
+	[[nodiscard]] auto snapshot() const -> std::vector<sample>;
+
+	// chrome://tracing and Perfetto "trace event" JSON of the current snapshot
+	[[nodiscard]] auto to_chrome_trace() const -> std::string;
+	[[nodiscard]] auto export_chrome_trace(std::string_view path) const -> result<>;
+
+private:
+	struct slot {
+		std::atomic<std::uint64_t> sequence{0}; // 2 * index + 2 once written, odd while being written
+		std::atomic<std::uint64_t> start{0};
+		std::atomic<std::uint64_t> duration{0};
+		std::atomic<std::uint64_t> tag{0}; // frame (32 bits) | thread (8 bits) | name (16 bits) | category (8 bits)
+	};
+
+	std::size_t frames_;
+	std::vector<slot> slots_;
+	std::atomic<std::uint64_t> head_{0};
+	std::atomic<std::uint32_t> frame_{0};
+	std::vector<std::string> names_;
+};
+
+} // namespace lge
@@ -3,69 +3,71 @@
 
 #pragma once
 
-#include <cstddef>
 #include <format>
+#include <memory>
 #include <optional>
 #include <source_location>
 #include <string>
+#include <utility>
 #include <variant>
-#include <vector>
 
 namespace lge {
 
+// =============================================================================
+// Error
+//
+// A chain of causes, the newest first. Causes are immutable and shared: an
+// error wrapping another points at the other's chain instead of copying it,
+// so each level of propagation allocates one cause, and copying an error only
+// copies a pointer. Locations are formatted only by to_string.
+// =============================================================================
+
 class error {
 public:
-	explicit error(const std::string &message, const std::source_location &location = std::source_location::current())
-		: causes_{cause{.message = message, .location = location}} {}
+	explicit error(std::string message, const std::source_location &location = std::source_location::current())
+		: head_{std::make_shared<const cause>(std::move(message), location, nullptr)} {}
 
-	error(const std::string &message,
+	error(std::string message,
 		  const error &other,
 		  const std::source_location &location = std::source_location::current())
-		: causes_{cause{.message = message, .location = location}} {
-		causes_.insert(causes_.end(), other.causes_.begin(), other.causes_.end());
-	}
+		: head_{std::make_shared<const cause>(std::move(message), location, other.head_)} {}
 
-	error(const std::string &message,
+	error(std::string message,
 		  const std::optional<error> &other,
 		  const std::source_location &location = std::source_location::current())
-		: causes_{cause{.message = message, .location = location}} {
-		if(other) {
-			causes_.insert(causes_.end(), other->causes_.begin(), other->causes_.end());
-		}
-	}
+		: head_{std::make_shared<const cause>(std::move(message), location, other ? other->head_ : nullptr)} {}
 
 	[[nodiscard]] auto get_message() const noexcept -> const std::string & {
-		return causes_.front().message;
+		return head_->message;
 	}
 
 	[[nodiscard]] auto get_location() const noexcept -> const std::source_location & {
-		return causes_.front().location;
+		return head_->location;
 	}
 
 	[[nodiscard]] auto to_string() const -> std::string {
-		std::string out;
-		for(size_t i = 0; i < causes_.size(); ++i) {
-			const auto &[message, location] = causes_.at(i);
-			if(i == 0) {
-				out += format_message_with_location(message, location);
-			} else {
-				out += "\n  caused by: " + format_message_with_location(message, location);
-			}
+		std::string out = format_message_with_location(head_->message, head_->location);
+		for(const auto *c = head_->next.get(); c != nullptr; c = c->next.get()) {
+			out += "\n  caused by: " + format_message_with_location(c->message, c->location);
 		}
 		return out;
 	}
 
 private:
 	struct cause {
+		cause(std::string msg, const std::source_location &loc, std::shared_ptr<const cause> caused_by)
+			: message{std::move(msg)}, location{loc}, next{std::move(caused_by)} {}
+
 		std::string message;
 		std::source_location location;
+		std::shared_ptr<const cause> next;
 	};
 
 	static auto format_message_with_location(const std::string &msg, const std::source_location &loc) -> std::string {
 		return std::format("{} [{}:{} {}]", msg, loc.file_name(), loc.line(), loc.function_name());
 	}
 
-	std::vector<cause> causes_;
+	std::shared_ptr<const cause> head_; // never null
 };
 
 template<class Value = bool, class Error = error>
@@ -91,15 +93,24 @@ public:
 		return std::holds_alternative<Value>(*this);
 	}
 
-	[[nodiscard]] auto get_error() const noexcept -> Error {
+	[[nodiscard]] auto get_error() const & noexcept -> const Error & {
 		return std::get<Error>(*this);
 	}
 
-	[[nodiscard]] auto get_value() const noexcept -> Value {
+	[[nodiscard]] auto get_error() && noexcept -> Error {
+		return std::get<Error>(std::move(*this));
+	}
+
+	[[nodiscard]] auto get_value() const & noexcept -> const Value & {
 		return std::get<Value>(*this);
 	}
 
-	[[nodiscard]] auto unwrap(Value &value) const noexcept -> std::optional<Error> {
+	[[nodiscard]] auto get_value() && noexcept -> Value {
+		return std::get<Value>(std::move(*this));
+	}
+
+	// copies the value out of a result that is kept
+	[[nodiscard]] auto unwrap(Value &value) const & noexcept -> std::optional<Error> {
 		if(has_error()) {
 			return std::get<Error>(*this);
 		}
@@ -107,6 +118,15 @@ public:
 		return std::nullopt;
 	}
 
+	// moves the value out of a temporary, as in `if(const auto err = load(uri).unwrap(handle); err)`
+	[[nodiscard]] auto unwrap(Value &value) && noexcept -> std::optional<Error> {
+		if(has_error()) {
+			return std::get<Error>(std::move(*this));
+		}
+		value = std::get<Value>(std::move(*this));
+		return std::nullopt;
+	}
+
 	[[nodiscard]] auto unwrap() const noexcept -> std::optional<Error> {
 		if(has_error()) {
 			return std::get<Error>(*this);
@@ -4,43 +4,87 @@
 #pragma once
 
 #include <lge/core/result.hpp>
+#include <lge/dispatcher/inline_handler.hpp>
 #include <lge/dispatcher/subscription.hpp>
+#include <lge/dispatcher/thread_slot.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <entt/core/fwd.hpp>
 #include <entt/core/type_info.hpp>
-#include <functional>
-#include <unordered_map>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace lge {
 
+// =============================================================================
+// Dispatcher
+//
+// Handlers are kept in one channel per event type, found by the type's
+// sequential index, so posting is an indexed lookup and a loop over handlers
+// stored inline in a vector, with no hashing and no type erasure of the event.
+//
+// Events may also be queued with enqueue and delivered later by drain, which
+// the app runs at defined points of the frame, so systems never run handler
+// code while they iterate their own views. Queued events of a type are handed
+// whole to batch handlers as a span, and one by one to the others.
+//
+// Any thread may enqueue, without locks: each thread appends to its own
+// buffer in the channel, found by its thread_slot. Drain runs on the main
+// thread once no other thread is queuing, and merges the buffers in slot
+// order. Which thread gets which slot varies from run to run, so event types
+// with an ordering, like collision, are sorted after the merge to be
+// delivered in the same order on every run, however the work was split.
+//
+// A channel is created on the main thread, by subscribing or by prepare, the
+// first enqueue of a type is not thread safe. Subscribe, unsubscribe and post
+// belong to the main thread too.
+// =============================================================================
+
 class dispatcher {
 public:
+	// events queued by handlers while draining are delivered in further rounds, up to this many
+	static constexpr std::size_t max_drain_rounds = 16;
+
 	template<typename Event>
-	using handler = std::function<result<>(const Event &)>;
+	using handler = inline_handler<Event>;
 
 	template<typename Event>
-	[[nodiscard]] auto subscribe(handler<Event> h) -> subscription {
-		const auto key = entt::type_hash<Event>::value();
-		const auto id = next_id_++;
+	using batch_handler = inline_handler<std::span<const Event>>;
 
-		auto &list = handlers_[key];
-		list.push_back(
-			{id, [h = std::move(h)](const void *evt) -> result<> { return h(*static_cast<const Event *>(evt)); }});
+	template<typename Event, typename Handler>
+	[[nodiscard]] auto subscribe(Handler &&h) -> subscription {
+		const auto id = next_id_++;
+		channel_for<Event>().entries.push_back({.id = id, .handler = handler<Event>{std::forward<Handler>(h)}});
+		return subscription{.event_type = entt::type_hash<Event>::value(), .id = id};
+	}
 
-		return subscription{.event_type = key, .id = id};
+	// called once per drain with every queued event of the type, not called for posted ones
+	template<typename Event, typename Handler>
+	[[nodiscard]] auto subscribe_batch(Handler &&h) -> subscription {
+		const auto id = next_id_++;
+		channel_for<Event>().batches.push_back({.id = id, .handler = batch_handler<Event>{std::forward<Handler>(h)}});
+		return subscription{.event_type = entt::type_hash<Event>::value(), .id = id};
 	}
 
 	[[nodiscard]] auto unsubscribe(subscription token) -> result<> {
-		const auto it = handlers_.find(token.event_type);
-		if(it == handlers_.end()) [[unlikely]] {
+		const auto it = std::ranges::find_if(channels_, [&token](const std::unique_ptr<channel_base> &c) -> bool {
+			return c != nullptr && c->event_type == token.event_type;
+		});
+		if(it == channels_.end()) [[unlikely]] {
 			return error("dispatcher::off — no handlers registered for this event type");
 		}
 
-		if(const auto erased = std::erase_if(it->second, [&](const entry &e) -> bool { return e.id == token.id; });
-		   erased == 0) [[unlikely]] {
+		if(!(*it)->remove(token.id)) [[unlikely]] {
 			return error("dispatcher::off — subscription token not found (already removed?)");
 		}
 
@@ -49,14 +93,13 @@ public:
 
 	template<typename Event>
 	[[nodiscard]] auto post(const Event &event) const -> result<> {
-		const auto key = entt::type_hash<Event>::value();
-		const auto it = handlers_.find(key);
-		if(it == handlers_.end()) [[unlikely]] {
+		const auto index = static_cast<std::size_t>(entt::type_index<Event>::value());
+		if(index >= channels_.size() || channels_[index] == nullptr) [[unlikely]] {
 			return true;
 		}
 
-		for(const auto &e: it->second) {
-			if(const auto err = e.handler(&event).unwrap(); err) [[unlikely]] {
+		for(const auto &e: static_cast<const channel<Event> &>(*channels_[index]).entries) {
+			if(const auto err = e.handler(event).unwrap(); err) [[unlikely]] {
 				return *err;
 			}
 		}
@@ -64,17 +107,153 @@ public:
 		return true;
 	}
 
+	template<typename Event>
+	auto enqueue(Event event) -> void {
+		channel_for<Event>().push(std::move(event));
+	}
+
+	// creates the channel of an event type, before threads other than the main one queue it
+	template<typename Event>
+	auto prepare() -> void {
+		std::ignore = channel_for<Event>();
+	}
+
+	[[nodiscard]] auto drain() -> result<> {
+		for(std::size_t round = 0; round < max_drain_rounds; ++round) {
+			auto delivered = false;
+			// by index, a handler subscribing to a new event type may grow the channels
+			for(std::size_t i = 0; i < channels_.size(); ++i) {
+				if(channels_[i] == nullptr || !channels_[i]->pending()) [[likely]] {
+					continue;
+				}
+				delivered = true;
+				if(const auto err = channels_[i]->deliver().unwrap(); err) [[unlikely]] {
+					return error("dispatcher::drain — failed to deliver queued events", *err);
+				}
+			}
+			if(!delivered) {
+				return true;
+			}
+		}
+		return error("dispatcher::drain — handlers kept queuing events, some are left for the next drain");
+	}
+
 private:
+	struct channel_base {
+		explicit channel_base(const entt::id_type type): event_type{type} {}
+		channel_base(const channel_base &) = delete;
+		channel_base(channel_base &&) = delete;
+		auto operator=(const channel_base &) -> channel_base & = delete;
+		auto operator=(channel_base &&) -> channel_base & = delete;
+		virtual ~channel_base() = default;
+
+		[[nodiscard]] virtual auto remove(uint32_t id) -> bool = 0;
+		[[nodiscard]] virtual auto pending() const -> bool = 0;
+		[[nodiscard]] virtual auto deliver() -> result<> = 0;
+
+		entt::id_type event_type; // the hash handed out in subscriptions
+	};
+
+	template<typename Argument>
 	struct entry {
 		uint32_t id;
-		std::function<result<>(const void *)> handler;
+		inline_handler<Argument> handler;
 	};
 
-	using handler_list = std::vector<entry>;
-	using handler_map = std::unordered_map<entt::id_type, handler_list>;
+	template<typename Event>
+	struct channel final: channel_base {
+		channel(): channel_base{entt::type_hash<Event>::value()} {}
+
+		[[nodiscard]] auto remove(const uint32_t id) -> bool override {
+			const auto same_id = [id](const auto &e) -> bool { return e.id == id; };
+			return std::erase_if(entries, same_id) != 0 || std::erase_if(batches, same_id) != 0;
+		}
+
+		// from any thread, into the buffer only the calling thread writes to
+		auto push(Event event) -> void {
+			const auto slot = thread_slot::current();
+			auto &buffer = queued[slot];
+			if(buffer == nullptr) [[unlikely]] {
+				buffer = std::make_unique<std::vector<Event>>();
+				const auto bit = std::uint64_t{1} << (slot % thread_slot::slots_per_word);
+				producers[slot / thread_slot::slots_per_word].fetch_or(bit, std::memory_order_relaxed);
+			}
+			buffer->push_back(std::move(event));
+		}
+
+		[[nodiscard]] auto pending() const -> bool override {
+			auto found = false;
+			for_each_producer([&found](const std::vector<Event> &buffer) -> void { found = found || !buffer.empty(); });
+			return found;
+		}
+
+		[[nodiscard]] auto deliver() -> result<> override {
+			// merged in slot order; events queued from here on wait for the next round
+			for_each_producer([this](std::vector<Event> &buffer) -> void {
+				delivering.insert(
+					delivering.end(), std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+				buffer.clear();
+			});
+			if constexpr(std::totally_ordered<Event>) {
+				std::ranges::stable_sort(delivering);
+			}
+
+			auto res = call_handlers(delivering);
+			delivering.clear();
+			return res;
+		}
+
+		std::vector<entry<Event>> entries;
+		std::vector<entry<std::span<const Event>>> batches;
+
+		// one buffer per thread slot that ever queued this type, keeping its capacity between drains
+		std::array<std::unique_ptr<std::vector<Event>>, thread_slot::max_slots> queued;
+		std::array<std::atomic<std::uint64_t>, thread_slot::max_slots / thread_slot::slots_per_word> producers{};
+		std::vector<Event> delivering;
+
+	private:
+		template<typename Fn>
+		auto for_each_producer(Fn &&fn) const -> void {
+			for(std::size_t word = 0; word < producers.size(); ++word) {
+				for(auto bits = producers[word].load(std::memory_order_relaxed); bits != 0; bits &= bits - 1) {
+					const auto slot = (word * thread_slot::slots_per_word) + std::countr_zero(bits);
+					fn(*queued[slot]);
+				}
+			}
+		}
+
+		[[nodiscard]] auto call_handlers(const std::span<const Event> events) const -> result<> {
+			for(const auto &b: batches) {
+				if(const auto err = b.handler(events).unwrap(); err) [[unlikely]] {
+					return *err;
+				}
+			}
+			for(const auto &event: events) {
+				for(const auto &e: entries) {
+					if(const auto err = e.handler(event).unwrap(); err) [[unlikely]] {
+						return *err;
+					}
+				}
+			}
+			return true;
+		}
+	};
+
+	template<typename Event>
+	[[nodiscard]] auto channel_for() -> channel<Event> & {
+		const auto index = static_cast<std::size_t>(entt::type_index<Event>::value());
+		if(index >= channels_.size()) {
+			channels_.resize(index + 1);
+		}
+		if(channels_[index] == nullptr) {
+			channels_[index] = std::make_unique<channel<Event>>();
+		}
+		return static_cast<channel<Event> &>(*channels_[index]);
+	}
 
-	handler_map handlers_;
+	// indexed by entt::type_index, null for event types nobody subscribed to
+	std::vector<std::unique_ptr<channel_base>> channels_;
 	uint32_t next_id_ = 0;
 };
 
-} // namespace lge
\ No newline at end of file
+} // namespace lge
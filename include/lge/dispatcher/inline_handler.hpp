@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/result.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lge {
+
+// =============================================================================
+// Inline handler
+//
+// An event handler stored in place, with no heap allocation: the callable is
+// moved into a fixed buffer and called through a single table of functions
+// chosen when it is stored. Lambdas capturing this or a few references fit
+// with room to spare; anything bigger is rejected when it is compiled. The
+// argument is an event, or a span of them for handlers taking a batch.
+// =============================================================================
+
+template<typename Argument>
+class inline_handler {
+public:
+	static constexpr std::size_t capacity = 6 * sizeof(void *);
+	static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+	template<typename Fn>
+		requires(!std::is_same_v<std::remove_cvref_t<Fn>, inline_handler>
+				 && std::is_invocable_r_v<result<>, std::remove_cvref_t<Fn> &, const Argument &>)
+	inline_handler(Fn &&fn) // NOLINT(*-explicit-constructor, *-forwarding-reference-overload)
+		: operations_{&operations_for<std::remove_cvref_t<Fn>>} {
+		using callable = std::remove_cvref_t<Fn>;
+		static_assert(sizeof(callable) <= capacity, "handler captures too much to be stored inline");
+		static_assert(alignof(callable) <= alignment, "handler is over-aligned for inline storage");
+		static_assert(std::is_nothrow_move_constructible_v<callable>, "handler must be nothrow move constructible");
+		::new(static_cast<void *>(storage_)) callable(std::forward<Fn>(fn));
+	}
+
+	inline_handler(const inline_handler &) = delete;
+	auto operator=(const inline_handler &) -> inline_handler & = delete;
+
+	inline_handler(inline_handler &&other) noexcept: operations_{other.operations_} {
+		operations_->move(storage_, other.storage_);
+	}
+
+	auto operator=(inline_handler &&other) noexcept -> inline_handler & {
+		if(this != &other) {
+			operations_->destroy(storage_);
+			operations_ = other.operations_;
+			operations_->move(storage_, other.storage_);
+		}
+		return *this;
+	}
+
+	~inline_handler() {
+		operations_->destroy(storage_);
+	}
+
+	auto operator()(const Argument &argument) const -> result<> {
+		return operations_->invoke(storage_, argument);
+	}
+
+private:
+	struct operations {
+		result<> (*invoke)(void *storage, const Argument &argument);
+		void (*move)(void *to, void *from) noexcept;
+		void (*destroy)(void *storage) noexcept;
+	};
+
+	template<typename Callable>
+	static constexpr operations operations_for{
+		.invoke = [](void *storage, const Argument &argument) -> result<> {
+			return (*std::launder(static_cast<Callable *>(storage)))(argument);
+		},
+		.move = [](void *to, void *from) noexcept -> void {
+			::new(to) Callable(std::move(*std::launder(static_cast<Callable *>(from))));
+		},
+		.destroy = [](void *storage) noexcept -> void {
+			std::destroy_at(std::launder(static_cast<Callable *>(storage)));
+		},
+	};
+
+	const operations *operations_;
+	// mutable so handlers keeping state between calls behave as they did with std::function
+	alignas(alignment) mutable std::byte storage_[capacity];
+};
+
+} // namespace lge
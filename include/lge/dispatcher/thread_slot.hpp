@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace lge {
+
+// =============================================================================
+// Thread slot
+//
+// A small index unique among the threads alive, so every thread can own an
+// entry of a fixed table and write to it without locking. A thread takes the
+// lowest free slot the first time it asks, with a compare and swap on a
+// bitmask, and gives it back when it exits, so pools created and destroyed
+// over and over do not run out of them.
+// =============================================================================
+
+class thread_slot {
+public:
+	static constexpr std::size_t max_slots = 256;
+	static constexpr std::size_t slots_per_word = 64;
+
+	// the calling thread's slot
+	[[nodiscard]] static auto current() -> std::size_t {
+		thread_local const owner slot{};
+		return slot.index;
+	}
+
+private:
+	struct owner {
+		std::size_t index = take();
+
+		owner() = default;
+		owner(const owner &) = delete;
+		owner(owner &&) = delete;
+		auto operator=(const owner &) -> owner & = delete;
+		auto operator=(owner &&) -> owner & = delete;
+		~owner() {
+			give_back(index);
+		}
+	};
+
+	inline static std::array<std::atomic<std::uint64_t>, max_slots / slots_per_word> taken_{};
+
+	static auto take() -> std::size_t {
+		for(std::size_t word = 0; word < taken_.size(); ++word) {
+			auto bits = taken_[word].load(std::memory_order_relaxed);
+			while(bits != ~std::uint64_t{0}) {
+				const auto bit = static_cast<std::size_t>(std::countr_one(bits));
+				if(taken_[word].compare_exchange_weak(
+					   bits, bits | (std::uint64_t{1} << bit), std::memory_order_acquire, std::memory_order_relaxed)) {
+					return (word * slots_per_word) + bit;
+				}
+			}
+		}
+		assert(false && "more threads alive than thread_slot::max_slots");
+		return max_slots - 1;
+	}
+
+	static auto give_back(const std::size_t index) -> void {
+		const auto bit = std::uint64_t{1} << (index % slots_per_word);
+		taken_[index / slots_per_word].fetch_and(~bit, std::memory_order_release);
+	}
+};
+
+} // namespace lge
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <compare>
 #include <entt/entity/fwd.hpp>
 
 namespace lge {
@@ -10,6 +11,9 @@ namespace lge {
 struct collision {
 	entt::entity first;
 	entt::entity second;
+
+	// ordered, so the collisions found on several threads are delivered in the same order every run
+	auto operator<=>(const collision &) const = default;
 };
 
 } // namespace lge
\ No newline at end of file
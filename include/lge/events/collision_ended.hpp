@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <compare>
+#include <entt/entity/fwd.hpp>
+
+namespace lge {
+
+// posted on the first frame two entities stop overlapping; either entity may already be destroyed
+struct collision_ended {
+	entt::entity first;
+	entt::entity second;
+
+	auto operator<=>(const collision_ended &) const = default;
+};
+
+} // namespace lge
\ No newline at end of file
@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/colors.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/text/glyph_layout.hpp>
+#include <lge/text/text_segment.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <entt/core/fwd.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Draw payloads
+//
+// Each payload carries the arguments of the matching renderer::render_* call.
+// Text is referenced, not copied, so it must outlive the submit of the frame.
+// =============================================================================
+
+struct sprite_draw {
+	sprite_sheet_handle sheet;
+	entt::id_type frame;
+	glm::vec2 pivot_position;
+	glm::vec2 size;
+	glm::vec2 pivot;
+	float rotation;
+	bool flip_horizontal;
+	bool flip_vertical;
+	color tint;
+	resolved_frame source; // texture_id 0 when the renderer has to look the frame up
+};
+
+struct panel_draw {
+	sprite_sheet_handle sheet;
+	entt::id_type frame;
+	glm::vec2 pivot_position;
+	glm::vec2 size;
+	glm::vec2 pivot;
+	float rotation;
+	float border;
+	color tint;
+	resolved_frame source; // texture_id 0 when the renderer has to look the frame up
+};
+
+struct label_draw {
+	font_handle font;
+	const std::string *text;
+	int size;
+	color text_color;
+	glm::vec2 pivot_position;
+	glm::vec2 rotated_offset;
+	float rotation;
+};
+
+struct rich_label_draw {
+	font_handle font;
+	const std::string *text; // the segments are views into it
+	std::span<const text_segment> segments;
+	int size;
+	glm::vec2 pivot_position;
+	glm::vec2 rotated_offset;
+	float rotation;
+};
+
+// a label laid out ahead of time, scale is the drawn size over the size it was laid out at
+struct glyph_draw {
+	const glyph_layout *layout;
+	float scale;
+	glm::vec2 pivot_position;
+	glm::vec2 rotated_offset;
+	float rotation;
+};
+
+struct rect_draw {
+	glm::vec2 center;
+	glm::vec2 size;
+	float rotation;
+	color border_color;
+	color fill_color;
+	float border_thickness;
+};
+
+struct circle_draw {
+	glm::vec2 center;
+	float radius;
+	color border_color;
+	color fill_color;
+	float border_thickness;
+};
+
+struct quad_draw {
+	glm::vec2 p0;
+	glm::vec2 p1;
+	glm::vec2 p2;
+	glm::vec2 p3;
+	color quad_color;
+};
+
+// a texture filled by renderer::render_to_cache, drawn with its top left corner at origin
+struct cache_draw {
+	std::uint32_t cache;
+	glm::vec2 origin;
+	glm::vec2 size;
+};
+
+enum class draw_kind : std::uint8_t {
+	sprite,
+	panel,
+	label,
+	rich_label,
+	glyphs,
+	rect,
+	circle,
+	quad,
+	cache,
+};
+
+// =============================================================================
+// Draw list
+//
+// A frame of draw commands with a packed key, most significant first:
+//   layer (16 bits) | index (16 bits) | texture (24 bits) | kind (8 bits)
+// Sorting orders them by layer and index, keeping the order they were added
+// in otherwise. A command then moves back next to an earlier one of the same
+// texture and kind, so they batch, but only past commands whose area it does
+// not overlap, so the picture drawn never changes.
+// =============================================================================
+
+struct draw_command {
+	std::uint64_t key;
+	std::uint32_t sequence;
+	draw_kind kind;
+	std::uint32_t payload; // index into the payload array of kind
+	glm::vec2 low;		   // screen area the command draws in
+	glm::vec2 high;
+};
+
+class draw_list {
+public:
+	// commands looked back past for one of the same texture, bounding the cost of sorting
+	static constexpr std::size_t batch_window = 64;
+
+	// the kind is added by add
+	[[nodiscard]] static auto make_key(int layer, int index, std::uint32_t texture) noexcept -> std::uint64_t;
+
+	auto clear() noexcept -> void;
+	auto sort() -> void;
+
+	// area the next commands draw in, anywhere until set, so those commands never move
+	auto cover(const glm::vec2 &low, const glm::vec2 &high) noexcept -> void {
+		low_ = low;
+		high_ = high;
+	}
+
+	auto add(std::uint64_t key, const sprite_draw &draw) -> void;
+	auto add(std::uint64_t key, const panel_draw &draw) -> void;
+	auto add(std::uint64_t key, const label_draw &draw) -> void;
+	auto add(std::uint64_t key, const rich_label_draw &draw) -> void;
+	auto add(std::uint64_t key, const glyph_draw &draw) -> void;
+	auto add(std::uint64_t key, const rect_draw &draw) -> void;
+	auto add(std::uint64_t key, const circle_draw &draw) -> void;
+	auto add(std::uint64_t key, const quad_draw &draw) -> void;
+	auto add(std::uint64_t key, const cache_draw &draw) -> void;
+
+	[[nodiscard]] auto commands() const noexcept -> std::span<const draw_command> {
+		return commands_;
+	}
+	[[nodiscard]] auto sprites() const noexcept -> std::span<const sprite_draw> {
+		return sprites_;
+	}
+	[[nodiscard]] auto panels() const noexcept -> std::span<const panel_draw> {
+		return panels_;
+	}
+	[[nodiscard]] auto labels() const noexcept -> std::span<const label_draw> {
+		return labels_;
+	}
+	[[nodiscard]] auto rich_labels() const noexcept -> std::span<const rich_label_draw> {
+		return rich_labels_;
+	}
+	[[nodiscard]] auto glyphs() const noexcept -> std::span<const glyph_draw> {
+		return glyphs_;
+	}
+	[[nodiscard]] auto rects() const noexcept -> std::span<const rect_draw> {
+		return rects_;
+	}
+	[[nodiscard]] auto circles() const noexcept -> std::span<const circle_draw> {
+		return circles_;
+	}
+	[[nodiscard]] auto quads() const noexcept -> std::span<const quad_draw> {
+		return quads_;
+	}
+	[[nodiscard]] auto caches() const noexcept -> std::span<const cache_draw> {
+		return caches_;
+	}
+
+private:
+	std::vector<draw_command> commands_;
+	std::vector<sprite_draw> sprites_;
+	std::vector<panel_draw> panels_;
+	std::vector<label_draw> labels_;
+	std::vector<rich_label_draw> rich_labels_;
+	std::vector<glyph_draw> glyphs_;
+	std::vector<rect_draw> rects_;
+	std::vector<circle_draw> circles_;
+	std::vector<quad_draw> quads_;
+	std::vector<cache_draw> caches_;
+	glm::vec2 low_{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+	glm::vec2 high_{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
+
+	template<typename Draw>
+	auto push(std::uint64_t key, draw_kind kind, std::vector<Draw> &payloads, const Draw &draw) -> void {
+		commands_.push_back({
+			.key = (key & ~std::uint64_t{0xFF}) | static_cast<std::uint8_t>(kind),
+			.sequence = static_cast<std::uint32_t>(commands_.size()),
+			.kind = kind,
+			.payload = static_cast<std::uint32_t>(payloads.size()),
+			.low = low_,
+			.high = high_,
+		});
+		payloads.push_back(draw);
+	}
+
+	auto batch(std::span<draw_command> run) -> void;
+};
+
+} // namespace lge
@@ -188,6 +188,26 @@ public:
 
 	virtual auto update(float delta_time) -> void = 0;
 
+	// keeps the pressed and released edges read since they were last consumed, so a frame that runs no fixed step
+	// hands them to the next one that does
+	auto latch_edges() -> void {
+		for(std::size_t bid = 0; bid < max_actions; ++bid) {
+			latched_[bid].pressed = latched_[bid].pressed || states[bid].pressed;
+			latched_[bid].released = latched_[bid].released || states[bid].released;
+			states[bid].pressed = latched_[bid].pressed;
+			states[bid].released = latched_[bid].released;
+		}
+	}
+
+	// after a step has seen the edges, the later steps of the frame do not see them again
+	auto consume_edges() -> void {
+		latched_ = {};
+		for(auto &st: states) {
+			st.pressed = false;
+			st.released = false;
+		}
+	}
+
 	[[nodiscard]] virtual auto get_mouse_position() const -> glm::vec2 = 0;
 	[[nodiscard]] virtual auto is_mouse_button_pressed(size_t button) const -> bool = 0;
 	[[nodiscard]] virtual auto get_button_state(button b) const -> state = 0;
@@ -206,6 +226,9 @@ protected:
 			st.down = false;
 		}
 	}
+
+private:
+	std::array<state, max_actions> latched_{};
 };
 
 } // namespace lge
\ No newline at end of file
@@ -6,7 +6,9 @@
 #include <lge/app/app_config.hpp>
 #include <lge/core/colors.hpp>
 #include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
 #include <lge/interface/resources.hpp>
+#include <lge/text/glyph_layout.hpp>
 #include <lge/text/text_segment.hpp>
 
 #include <cstdint>
@@ -53,12 +55,19 @@ public:
 							  float rotation) const -> void = 0;
 
 	virtual auto render_rich_label(font_handle font,
+								   const std::string &text,
 								   std::span<const text_segment> segments,
 								   const int &size,
 								   const glm::vec2 &pivot_position,
 								   const glm::vec2 &rotated_offset,
 								   float rotation) const -> void = 0;
 
+	virtual auto render_glyphs(const glyph_layout &layout,
+							   float scale,
+							   const glm::vec2 &pivot_position,
+							   const glm::vec2 &rotated_offset,
+							   float rotation) const -> void = 0;
+
 	virtual auto render_quad(const glm::vec2 &p0,
 							 const glm::vec2 &p1,
 							 const glm::vec2 &p2,
@@ -97,12 +106,32 @@ public:
 							  float border,
 							  color tint) const -> void = 0;
 
+	// draws every command of a sorted list in order
+	virtual auto submit(const draw_list &list) const -> void = 0;
+
+	// draws a sorted list into the off-screen texture kept as cache, world position origin landing on its top left
+	// corner; the texture is created or resized to size as needed and drawn later through a cache_draw
+	virtual auto render_to_cache(std::uint32_t cache,
+								 const glm::vec2 &origin,
+								 const glm::vec2 &size,
+								 const draw_list &list) -> void = 0;
+	virtual auto release_cache(std::uint32_t cache) -> void = 0;
+
 	virtual auto get_label_size(font_handle font, const std::string &text, const int &size) -> glm::vec2 = 0;
 
+	// shapes text, rich tags included, into quads that render_glyphs draws without shaping it again
+	[[nodiscard]] virtual auto layout_label(font_handle font,
+											const std::string &text,
+											const int &size,
+											const color &text_color) -> glyph_layout = 0;
+
 	virtual auto get_texture_size(texture_handle texture) -> glm::vec2 = 0;
 
 	virtual auto get_sprite_frame_size(sprite_sheet_handle sheet, entt::id_type frame) -> glm::vec2 = 0;
 
+	[[nodiscard]] virtual auto resolve_sprite_frame(sprite_sheet_handle sheet, entt::id_type frame) const
+		-> result<resolved_frame> = 0;
+
 	virtual auto show_cursor(bool show) -> void = 0;
 
 	virtual auto get_delta_time() -> float = 0;
@@ -7,6 +7,8 @@
 #include <lge/interface/resources.hpp>
 
 #include <core/fwd.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <entt/entt.hpp>
 #include <string_view>
 
@@ -59,8 +61,9 @@ public:
 	// =============================================================================
 	[[nodiscard]] virtual auto load_animation_library(std::string_view uri) -> result<animation_library_handle> = 0;
 	[[nodiscard]] virtual auto unload_animation_library(animation_library_handle handle) -> result<> = 0;
+	// the clip stays owned by its library, valid until the library is unloaded
 	[[nodiscard]] virtual auto get_animation(animation_library_handle handle, entt::id_type anim_name) const
-		-> result<animation_library_anim> = 0;
+		-> result<const animation_library_anim *> = 0;
 	[[nodiscard]] virtual auto get_animation_sprite_sheet(animation_library_handle handle) const
 		-> result<sprite_sheet_handle> = 0;
 
@@ -77,6 +80,45 @@ public:
 
 	[[nodiscard]] virtual auto load_music(std::string_view uri) -> result<music_handle> = 0;
 	[[nodiscard]] virtual auto unload_music(music_handle handle) -> result<> = 0;
+
+	// =============================================================================
+	// Asynchronous loading
+	//
+	// The async variants return a pending handle at once; files are read,
+	// parsed and decoded on loader threads and only the GPU upload happens on
+	// the main thread, in update_loads, which the app calls every frame. Check
+	// get_load_state before using the handle; unloading it as usual also drops
+	// a load still pending.
+	// =============================================================================
+
+	[[nodiscard]] virtual auto load_texture_async(std::string_view uri) -> result<texture_handle> = 0;
+	[[nodiscard]] virtual auto load_sprite_sheet_async(std::string_view uri) -> result<sprite_sheet_handle> = 0;
+	[[nodiscard]] virtual auto load_animation_library_async(std::string_view uri)
+		-> result<animation_library_handle> = 0;
+
+	[[nodiscard]] virtual auto get_load_state(texture_handle handle) const -> load_state = 0;
+	// a sprite sheet is ready once its texture is, and an animation library once its sprite sheet is
+	[[nodiscard]] virtual auto get_load_state(sprite_sheet_handle handle) const -> load_state = 0;
+	[[nodiscard]] virtual auto get_load_state(animation_library_handle handle) const -> load_state = 0;
+
+	// finishes up to max_finished loads whose background work is done
+	virtual auto update_loads(std::size_t max_finished) -> void = 0;
+	// asynchronous loads not finished yet, e.g. for the progress of a loading screen
+	[[nodiscard]] virtual auto pending_loads() const -> std::size_t = 0;
+
+	// changes whenever a texture or sprite sheet is loaded or unloaded, so cached frames and backend texture ids,
+	// including those resolved while still loading, can be revalidated
+	[[nodiscard]] auto texture_generation() const noexcept -> std::uint32_t {
+		return texture_generation_;
+	}
+
+protected:
+	auto bump_texture_generation() noexcept -> void {
+		++texture_generation_;
+	}
+
+private:
+	std::uint32_t texture_generation_ = 0;
 };
 
 } // namespace lge
\ No newline at end of file
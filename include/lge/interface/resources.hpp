@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <entt/core/fwd.hpp>
 #include <entt/entity/entity.hpp>
 #include <format>
@@ -58,6 +59,9 @@ struct music_tag {};
 using music_handle = resource_handle<music_tag>;
 inline constexpr music_handle invalid_music{};
 
+// where a resource loaded asynchronously is; resources loaded the usual way are ready once their load returns
+enum class load_state : std::uint8_t { pending, ready, failed };
+
 // =============================================================================
 // Data
 // =============================================================================
@@ -68,6 +72,14 @@ struct sprite_sheet_frame {
 	glm::vec2 pivot;
 };
 
+// sprite sheet frame resolved down to the backend texture, so drawing it needs no lookups
+struct resolved_frame {
+	std::uint32_t texture_id; // backend texture id, 0 when unresolved
+	glm::vec2 texture_size;
+	glm::vec2 source_pos;
+	glm::vec2 source_size;
+};
+
 struct animation_library_anim {
 	std::vector<entt::hashed_string> frames;
 	float fps;
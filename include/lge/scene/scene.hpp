@@ -6,6 +6,7 @@
 #include <lge/app/context.hpp>
 #include <lge/components/clear_on_scene_exit.hpp>
 #include <lge/core/log.hpp>
+#include <lge/core/profiler.hpp>
 #include <lge/core/result.hpp>
 #include <lge/core/types.hpp>
 #include <lge/systems/system.hpp>
@@ -68,6 +69,8 @@ public:
 		}
 		const auto type_name = get_type_name<System_T>();
 		systems_.push_back(std::move(sys));
+		auto *profiling = ctx.world.ctx().find<profiler>();
+		system_names_.push_back(profiling != nullptr ? profiling->intern(type_name) : profiler::name_id{});
 		log::debug("scene system of type `{}` registered", type_name);
 		return true;
 	}
@@ -79,6 +82,7 @@ private:
 	[[nodiscard]] auto update_systems(float dt) -> result<>;
 
 	std::vector<std::unique_ptr<system>> systems_;
+	std::vector<profiler::name_id> system_names_; // parallel to systems_
 };
 
 } // namespace lge
@@ -6,8 +6,13 @@
 #include <lge/app/context.hpp>
 #include <lge/core/result.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <entt/core/type_info.hpp>
 #include <entt/entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <tuple>
+#include <vector>
 
 namespace lge {
 
@@ -15,6 +20,81 @@ using system_id = uint32_t;
 
 enum class phase : std::uint8_t { game_update, local_update, global_update, render, post_render };
 
+// =============================================================================
+// System access
+//
+// The components a system reads and writes in update. Systems of the same
+// phase whose accesses do not conflict may run at the same time; conflicting
+// ones keep their registration order. Declaring nothing means exclusive: the
+// system runs alone, as it would when systems ran one after the other.
+// =============================================================================
+
+class system_access {
+public:
+	[[nodiscard]] static auto exclusive() -> system_access {
+		return {};
+	}
+
+	template<typename... Components>
+	auto read() -> system_access & {
+		(add<Components>(reads_), ...);
+		exclusive_ = false;
+		return *this;
+	}
+
+	template<typename... Components>
+	auto write() -> system_access & {
+		(add<Components>(writes_), ...);
+		exclusive_ = false;
+		return *this;
+	}
+
+	[[nodiscard]] auto is_exclusive() const noexcept -> bool {
+		return exclusive_;
+	}
+
+	[[nodiscard]] auto conflicts_with(const system_access &other) const -> bool {
+		if(exclusive_ || other.exclusive_) {
+			return true;
+		}
+		return overlaps(writes_, other.writes_) || overlaps(writes_, other.reads_) || overlaps(reads_, other.writes_);
+	}
+
+	// creating a component storage is not thread safe, so it is done before systems run concurrently
+	auto prepare(entt::registry &world) const -> void {
+		for(const auto &c: reads_) {
+			c.assure(world);
+		}
+		for(const auto &c: writes_) {
+			c.assure(world);
+		}
+	}
+
+private:
+	struct component {
+		entt::id_type id;
+		void (*assure)(entt::registry &);
+	};
+
+	std::vector<component> reads_;
+	std::vector<component> writes_;
+	bool exclusive_ = true;
+
+	template<typename Component>
+	static auto add(std::vector<component> &to) -> void {
+		to.push_back({
+			.id = entt::type_hash<Component>::value(),
+			.assure = [](entt::registry &world) -> void { std::ignore = world.storage<Component>(); },
+		});
+	}
+
+	static auto overlaps(const std::vector<component> &a, const std::vector<component> &b) -> bool {
+		return std::ranges::any_of(a, [&b](const component &x) -> bool {
+			return std::ranges::any_of(b, [&x](const component &y) -> bool { return x.id == y.id; });
+		});
+	}
+};
+
 class system {
 public:
 	explicit system(const phase p, context &app_context): ctx{app_context}, phase_{p} {}
@@ -41,6 +121,11 @@ public:
 		return true;
 	}
 
+	// what update touches, systems that do not override it run alone
+	[[nodiscard]] virtual auto access() const -> system_access {
+		return system_access::exclusive();
+	}
+
 protected:
 	context &ctx;
 
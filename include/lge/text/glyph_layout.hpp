@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/colors.hpp>
+#include <lge/interface/resources.hpp>
+
+#include <glm/ext/vector_float2.hpp>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Glyph layout
+//
+// Text shaped once into quads of its font atlas, relative to the top left of
+// the text at the size it was laid out at. Drawing it is a copy of its quads,
+// scaled to the size drawn at, with no text walking or glyph lookups.
+// =============================================================================
+
+struct glyph_quad {
+	glm::vec2 source_pos; // in the font atlas
+	glm::vec2 source_size;
+	glm::vec2 offset; // top left of the quad from the top left of the text
+	glm::vec2 size;
+	color tint;
+};
+
+struct glyph_layout {
+	font_handle font;
+	float size = 0.F; // font size the quads were laid out at
+	std::vector<glyph_quad> glyphs;
+};
+
+} // namespace lge
@@ -5,16 +5,25 @@
 
 #include <lge/core/colors.hpp>
 
-#include <string>
+#include <cstddef>
+#include <string_view>
 
 namespace lge {
 // =============================================================================
 // Rich text segment
+//
+// A run of the parsed text between two tags, referenced rather than copied,
+// so it is only valid while that text is alive and unchanged.
 // =============================================================================
 
 struct text_segment {
-	std::string text;
+	std::size_t offset; // into the parsed text
+	std::size_t length;
 	color segment_color;
+
+	[[nodiscard]] auto view(const std::string_view text) const noexcept -> std::string_view {
+		return text.substr(offset, length);
+	}
 };
 
 } // namespace lge
\ No newline at end of file
@@ -3,9 +3,13 @@
 
 #include <lge/app/app.hpp>
 #include <lge/core/log.hpp>
+#include <lge/core/profiler.hpp>
 #include <lge/core/result.hpp>
 #include <lge/interface/backend.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
 #include <lge/internal/raylib/raylib_backend.hpp>
+#include <lge/internal/scheduler/system_scheduler.hpp>
+#include <lge/internal/scheduler/thread_pool.hpp>
 #include <lge/internal/systems/animation_system.hpp>
 #include <lge/internal/systems/bounds_system.hpp>
 #include <lge/internal/systems/button_system.hpp>
@@ -20,7 +24,15 @@
 #include <lge/internal/systems/transition_system.hpp>
 #include <lge/systems/system.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
 
 #ifdef __EMSCRIPTEN__
 #	include <emscripten/emscripten.h>
@@ -28,8 +40,10 @@
 
 namespace lge {
 
-app::app()
-	: backend_{raylib_backend::create()},
+app::app(): app(raylib_backend::create()) {}
+
+app::app(backend backend)
+	: backend_{std::move(backend)},
 	  ctx{
 		  .render = *backend_.renderer_ptr,
 		  .actions = *backend_.input_ptr,
@@ -38,7 +52,26 @@ app::app()
 		  .world = registry_,
 		  .events = dispatcher_,
 	  },
-	  scenes{ctx} {}
+	  scenes{ctx}, scheduler_{std::make_unique<system_scheduler>()} {
+	// lives in the registry context so scenes can time their own systems
+	profiler_ = &registry_.ctx().emplace<profiler>();
+	profile_names_ = {
+		.frame = profiler_->intern("frame"),
+		.begin_frame = profiler_->intern("begin_frame"),
+		.end_frame = profiler_->intern("end_frame"),
+		.update_music = profiler_->intern("update_music"),
+		.loads = profiler_->intern("loads"),
+		.scenes = profiler_->intern("scenes"),
+		.events = profiler_->intern("events"),
+		.phases = {profiler_->intern("game_update"),
+				   profiler_->intern("local_update"),
+				   profiler_->intern("global_update"),
+				   profiler_->intern("render"),
+				   profiler_->intern("post_render")},
+	};
+}
+
+app::~app() = default;
 
 auto app::run() -> result<> {
 	if(const auto err = init().unwrap(); err) [[unlikely]] {
@@ -78,6 +111,25 @@ auto app::run() -> result<> {
 	return true;
 }
 
+auto app::run_for(const std::size_t frames) -> result<> {
+	if(const auto err = init().unwrap(); err) [[unlikely]] {
+		return error("failed to init the application", *err);
+	}
+
+	for(std::size_t frame = 0; frame < frames; ++frame) {
+		if(const auto err = main_loop().unwrap(); err) [[unlikely]] {
+			return error("error during main loop", *err);
+		}
+	}
+
+	if(const auto err = end().unwrap(); err) [[unlikely]] {
+		return error("error ending the application", *err);
+	}
+
+	log::info("application ended after {} frames", frames);
+	return true;
+}
+
 auto app::update(float /*dt*/) -> result<> {
 	return true;
 }
@@ -85,7 +137,27 @@ auto app::update(float /*dt*/) -> result<> {
 auto app::init() -> result<> {
 	log::init();
 
-	if(const auto err = backend_.renderer_ptr->init(configure()).unwrap(); err) [[unlikely]] {
+	const auto config = configure();
+	profiler_->set_frame_capacity(config.profiler_frames);
+
+	fixed_timestep_ = config.fixed_timestep;
+	max_steps_ = std::max<std::size_t>(config.max_steps_per_frame, 1);
+	max_loads_ = std::max<std::size_t>(config.max_loads_per_frame, 1);
+	accumulator_ = 0.F;
+
+#ifndef __EMSCRIPTEN__
+	if(config.parallel_systems) {
+		const auto workers = config.worker_threads != 0 ? config.worker_threads
+														: std::max(std::thread::hardware_concurrency(), 1U) - 1;
+		if(workers > 0) {
+			// in the registry context so systems can split their own work on it
+			pool_ = &registry_.ctx().emplace<thread_pool>(workers);
+			log::debug("systems run on up to {} worker threads", workers);
+		}
+	}
+#endif
+
+	if(const auto err = backend_.renderer_ptr->init(config).unwrap(); err) [[unlikely]] {
 		return error("failed to initialize renderer", *err);
 	}
 
@@ -112,7 +184,12 @@ auto app::init() -> result<> {
 	if(const auto err = register_system<order_system>(phase::global_update).unwrap(); err) [[unlikely]] {
 		return error("failed to register order_system", *err);
 	}
-	if(const auto err = register_system<collision_system>(phase::global_update).unwrap(); err) [[unlikely]] {
+	if(config.collision_cell_size <= 0.F || !std::isfinite(config.collision_cell_size)) [[unlikely]] {
+		return error("invalid collision cell size, it must be positive");
+	}
+	if(const auto err =
+		   register_system<collision_system>(phase::global_update, config.collision_cell_size).unwrap();
+	   err) [[unlikely]] {
 		return error("failed to register collision_system", *err);
 	}
 	if(const auto err = register_system<pointer_system>(phase::global_update).unwrap(); err) [[unlikely]] {
@@ -166,8 +243,25 @@ auto app::end() -> result<> {
 }
 
 auto app::main_loop() -> result<> {
-	if(const auto err = backend_.renderer_ptr->begin_frame().unwrap(); err) [[unlikely]] {
-		return error("failed to begin frame", *err);
+	profiler_->begin_frame();
+	const profiler::scope frame_scope{profiler_, profile_names_.frame, profiler::category::frame};
+
+	{
+		const profiler::scope scope{profiler_, profile_names_.begin_frame, profiler::category::backend};
+		if(const auto err = backend_.renderer_ptr->begin_frame().unwrap(); err) [[unlikely]] {
+			return error("failed to begin frame", *err);
+		}
+	}
+
+	if(schedule_dirty_) [[unlikely]] {
+		scheduler_->build(systems_, registry_);
+		schedule_dirty_ = false;
+	}
+
+	// resources loaded in the background are ready before anything this frame asks for them
+	{
+		const profiler::scope scope{profiler_, profile_names_.loads, profiler::category::backend};
+		backend_.resource_manager_ptr->update_loads(max_loads_);
 	}
 
 	const auto delta_time = backend_.renderer_ptr->get_delta_time();
@@ -176,19 +270,10 @@ auto app::main_loop() -> result<> {
 
 	backend_.renderer_ptr->show_cursor(!backend_.input_ptr->is_controller_available());
 
-	if(const auto err = update(delta_time).unwrap(); err) [[unlikely]] {
-		return error("failed to update the application", *err);
-	}
-
-	if(const auto err = update_system(phase::game_update, delta_time).unwrap(); err) [[unlikely]] {
-		return error("failed to update systems in game update phase", *err);
-	}
-
-	if(const auto err = scenes.update(delta_time).unwrap(); err) [[unlikely]] {
-		return error("failed to update scenes", *err);
+	if(const auto err = simulate(delta_time).unwrap(); err) [[unlikely]] {
+		return error("failed to simulate the frame", *err);
 	}
 
-
 	if(const auto err = update_system(phase::local_update, delta_time).unwrap(); err) [[unlikely]] {
 		return error("failed to update systems in local update phase", *err);
 	}
@@ -197,6 +282,11 @@ auto app::main_loop() -> result<> {
 		return error("failed to update systems in global update phase", *err);
 	}
 
+	// collisions, clicks and button presses, before anything is rendered
+	if(const auto err = drain_events().unwrap(); err) [[unlikely]] {
+		return error("failed to drain the events of the global update phase", *err);
+	}
+
 	if(const auto err = update_system(phase::render, delta_time).unwrap(); err) [[unlikely]] {
 		return error("failed to update systems in render phase", *err);
 	}
@@ -205,25 +295,129 @@ auto app::main_loop() -> result<> {
 		return error("failed to update systems in post render phase", *err);
 	}
 
-	if(const auto err = backend_.renderer_ptr->end_frame().unwrap(); err) [[unlikely]] {
-		return error("failed to end frame", *err);
+	{
+		const profiler::scope scope{profiler_, profile_names_.end_frame, profiler::category::backend};
+		if(const auto err = backend_.renderer_ptr->end_frame().unwrap(); err) [[unlikely]] {
+			return error("failed to end frame", *err);
+		}
 	}
 
-	if(const auto err = backend_.audio_manager_ptr->update_music().unwrap(); err) [[unlikely]] {
-		return error("failed to update music", *err);
+	{
+		const profiler::scope scope{profiler_, profile_names_.update_music, profiler::category::backend};
+		if(const auto err = backend_.audio_manager_ptr->update_music().unwrap(); err) [[unlikely]] {
+			return error("failed to update music", *err);
+		}
 	}
 	return true;
 }
 
-auto app::update_system(const phase p, const float dt) const -> result<> {
-	for(const auto &system: systems_) {
-		if(system->get_phase() == p) {
-			if(const auto err = system->update(dt).unwrap(); err) [[unlikely]] {
-				return error("failed to update system", *err);
+// input is read once per rendered frame, every step of a frame sees what is held but only the first one what was
+// pressed or released, kept for as many frames as it takes a step to run
+auto app::simulate(const float frame_time) -> result<> {
+	if(fixed_timestep_ <= 0.F) [[likely]] {
+		steps_ = 1;
+		return step(frame_time);
+	}
+
+	auto &actions = *backend_.input_ptr;
+	actions.latch_edges();
+
+	accumulator_ += frame_time;
+	steps_ = 0;
+	while(accumulator_ >= fixed_timestep_ && steps_ < max_steps_) {
+		if(const auto err = step(fixed_timestep_).unwrap(); err) [[unlikely]] {
+			return error("failed to run a fixed step", *err);
+		}
+		actions.consume_edges();
+		accumulator_ -= fixed_timestep_;
+		++steps_;
+	}
+
+	// a spike longer than the steps allowed drops the rest, instead of making the next frames longer too
+	if(accumulator_ >= fixed_timestep_) [[unlikely]] {
+		accumulator_ = std::fmod(accumulator_, fixed_timestep_);
+	}
+
+	return true;
+}
+
+auto app::step(const float dt) -> result<> {
+	if(const auto err = update(dt).unwrap(); err) [[unlikely]] {
+		return error("failed to update the application", *err);
+	}
+
+	if(const auto err = update_system(phase::game_update, dt).unwrap(); err) [[unlikely]] {
+		return error("failed to update systems in game update phase", *err);
+	}
+
+	{
+		const profiler::scope scope{profiler_, profile_names_.scenes, profiler::category::phase};
+		if(const auto err = scenes.update(dt).unwrap(); err) [[unlikely]] {
+			return error("failed to update scenes", *err);
+		}
+	}
+
+	// events the game queued during the step are handled within it
+	if(const auto err = drain_events().unwrap(); err) [[unlikely]] {
+		return error("failed to drain the events of the step", *err);
+	}
+
+	return true;
+}
+
+auto app::drain_events() -> result<> {
+	const profiler::scope scope{profiler_, profile_names_.events, profiler::category::phase};
+	return dispatcher_.drain();
+}
+
+auto app::update_system(const phase p, const float dt) -> result<> {
+	const profiler::scope phase_scope{
+		profiler_, profile_names_.phases.at(static_cast<std::size_t>(p)), profiler::category::phase};
+
+	if(pool_ == nullptr) {
+		for(std::size_t i = 0; i < systems_.size(); ++i) {
+			if(const auto &system = systems_[i]; system->get_phase() == p) {
+				const profiler::scope scope{profiler_, system_names_[i], profiler::category::system};
+				if(const auto err = system->update(dt).unwrap(); err) [[unlikely]] {
+					return error("failed to update system", *err);
+				}
 			}
 		}
+		return true;
+	}
+
+	for(const auto &batch: scheduler_->batches_of(p)) {
+		if(const auto err = update_batch(batch, dt).unwrap(); err) [[unlikely]] {
+			return error("failed to update system", *err);
+		}
+	}
+
+	return true;
+}
+
+auto app::update_batch(const std::span<const std::size_t> batch, const float dt) -> result<> {
+	if(batch.size() == 1) [[likely]] {
+		const auto index = batch.front();
+		const profiler::scope scope{profiler_, system_names_[index], profiler::category::system};
+		return systems_[index]->update(dt);
 	}
 
+	// rebuilt here if it changed, so the systems of the batch only read it
+	std::ignore = flat_hierarchy::of(registry_);
+
+	batch_errors_.assign(batch.size(), std::nullopt);
+	pool_->run(batch.size(), [this, batch, dt](const std::size_t i) -> void {
+		const auto index = batch[i];
+		const profiler::scope scope{profiler_, system_names_[index], profiler::category::system};
+		batch_errors_[i] = systems_[index]->update(dt).unwrap();
+	});
+
+	// the first failure in registration order, the one running them one after the other would report
+	for(const auto &err: batch_errors_) {
+		if(err) [[unlikely]] {
+			return *err;
+		}
+	}
 	return true;
 }
 
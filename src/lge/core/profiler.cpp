@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/profiler.hpp>
+#include <lge/core/result.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lge {
+
+namespace {
+
+constexpr auto frame_shift = 32U;
+constexpr auto thread_shift = 24U;
+constexpr auto thread_mask = 0xFFU;
+constexpr auto name_shift = 8U;
+constexpr auto name_mask = 0xFFFFU;
+constexpr auto category_mask = 0xFFU;
+
+const auto epoch = std::chrono::steady_clock::now();
+
+std::atomic<std::uint32_t> next_thread{0};
+
+auto thread_index() noexcept -> std::uint64_t {
+	thread_local const auto index = next_thread.fetch_add(1, std::memory_order_relaxed) & thread_mask;
+	return index;
+}
+
+auto category_name(const profiler::category kind) -> std::string_view {
+	switch(kind) {
+	case profiler::category::frame:
+		return "frame";
+	case profiler::category::phase:
+		return "phase";
+	case profiler::category::system:
+		return "system";
+	case profiler::category::backend:
+		return "backend";
+	}
+	return "unknown";
+}
+
+auto append_json_escaped(std::string &out, const std::string_view text) -> void {
+	for(const auto c: text) {
+		switch(c) {
+		case '"':
+			out += "\\\"";
+			break;
+		case '\\':
+			out += "\\\\";
+			break;
+		case '\n':
+			out += "\\n";
+			break;
+		default:
+			out += c;
+			break;
+		}
+	}
+}
+
+} // namespace
+
+profiler::profiler(const std::size_t frames): frames_{frames}, slots_(frames * samples_per_frame) {}
+
+auto profiler::set_frame_capacity(const std::size_t frames) -> void {
+	frames_ = frames;
+	slots_ = std::vector<slot>(frames * samples_per_frame);
+	head_.store(0, std::memory_order_relaxed);
+}
+
+auto profiler::intern(const std::string_view name) -> name_id {
+	if(const auto it = std::ranges::find(names_, name); it != names_.end()) {
+		return static_cast<name_id>(std::distance(names_.begin(), it));
+	}
+	names_.emplace_back(name);
+	return static_cast<name_id>(names_.size() - 1);
+}
+
+auto profiler::name_of(const name_id id) const -> std::string_view {
+	if(id >= names_.size()) [[unlikely]] {
+		return "unknown";
+	}
+	return names_[id];
+}
+
+auto profiler::now() noexcept -> std::uint64_t {
+	return static_cast<std::uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+auto profiler::record(const name_id name,
+					  const category kind,
+					  const std::uint64_t start_ns,
+					  const std::uint64_t end_ns) noexcept -> void {
+	if(slots_.empty()) [[unlikely]] {
+		return;
+	}
+
+	const auto index = head_.fetch_add(1, std::memory_order_relaxed);
+	auto &s = slots_[index % slots_.size()];
+
+	s.sequence.store((2 * index) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	s.start.store(start_ns, std::memory_order_relaxed);
+	s.duration.store(end_ns - start_ns, std::memory_order_relaxed);
+	s.tag.store((static_cast<std::uint64_t>(current_frame()) << frame_shift) | (thread_index() << thread_shift)
+					| (static_cast<std::uint64_t>(name) << name_shift) | static_cast<std::uint64_t>(kind),
+				std::memory_order_relaxed);
+
+	s.sequence.store((2 * index) + 2, std::memory_order_release);
+}
+
+auto profiler::snapshot() const -> std::vector<sample> {
+	std::vector<sample> samples;
+	if(slots_.empty()) [[unlikely]] {
+		return samples;
+	}
+
+	const auto head = head_.load(std::memory_order_acquire);
+	const auto count = std::min<std::uint64_t>(head, slots_.size());
+	const auto frame = current_frame();
+	const auto oldest_frame = frame >= frames_ ? frame - static_cast<std::uint32_t>(frames_) + 1 : 0U;
+	samples.reserve(count);
+
+	for(auto index = head - count; index < head; ++index) {
+		const auto &s = slots_[index % slots_.size()];
+
+		const auto sequence = s.sequence.load(std::memory_order_acquire);
+		if(sequence != (2 * index) + 2) {
+			continue; // overwritten by a newer sample or still being written
+		}
+
+		const auto start = s.start.load(std::memory_order_relaxed);
+		const auto duration = s.duration.load(std::memory_order_relaxed);
+		const auto tag = s.tag.load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if(s.sequence.load(std::memory_order_relaxed) != sequence) [[unlikely]] {
+			continue;
+		}
+
+		const auto sample_frame = static_cast<std::uint32_t>(tag >> frame_shift);
+		if(sample_frame < oldest_frame) {
+			continue;
+		}
+
+		samples.push_back({
+			.name = static_cast<name_id>((tag >> name_shift) & name_mask),
+			.kind = static_cast<category>(tag & category_mask),
+			.frame = sample_frame,
+			.thread = static_cast<std::uint8_t>((tag >> thread_shift) & thread_mask),
+			.start_ns = start,
+			.duration_ns = duration,
+		});
+	}
+
+	return samples;
+}
+
+auto profiler::to_chrome_trace() const -> std::string {
+	constexpr auto ns_per_us = 1000.0;
+
+	std::string out = R"({"displayTimeUnit":"ms","traceEvents":[)";
+	auto first = true;
+	for(const auto &s: snapshot()) {
+		if(!first) {
+			out += ',';
+		}
+		first = false;
+
+		out += R"({"name":")";
+		append_json_escaped(out, name_of(s.name));
+		out += std::format(R"(","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{},"args":{{"frame":{}}}}})",
+						   category_name(s.kind),
+						   static_cast<double>(s.start_ns) / ns_per_us,
+						   static_cast<double>(s.duration_ns) / ns_per_us,
+						   s.thread + 1,
+						   s.frame);
+	}
+	out += "]}";
+	return out;
+}
+
+auto profiler::export_chrome_trace(const std::string_view path) const -> result<> {
+	std::ofstream file{std::string(path)};
+	if(!file) [[unlikely]] {
+		return error(std::format("failed to open chrome trace file: {}", path));
+	}
+
+	file << to_chrome_trace();
+	if(!file) [[unlikely]] {
+		return error(std::format("failed to write chrome trace file: {}", path));
+	}
+	return true;
+}
+
+} // namespace lge
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/interface/draw_list.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <glm/ext/vector_float2.hpp>
+#include <limits>
+#include <span>
+
+namespace lge {
+
+namespace {
+
+constexpr std::uint64_t order_mask = 0xFFFFFFFF00000000ULL; // layer and index
+constexpr std::uint64_t batch_mask = 0x00000000FFFFFFFFULL; // texture and kind
+constexpr std::uint64_t texture_mask = 0x00000000FFFFFF00ULL;
+
+// maps a signed order value to 16 bits that sort the same way
+auto biased(const int value) noexcept -> std::uint64_t {
+	constexpr auto low = static_cast<int>(std::numeric_limits<std::int16_t>::min());
+	constexpr auto high = static_cast<int>(std::numeric_limits<std::int16_t>::max());
+	return static_cast<std::uint64_t>(std::clamp(value, low, high) - low);
+}
+
+auto overlap(const draw_command &a, const draw_command &b) noexcept -> bool {
+	return a.low.x < b.high.x && b.low.x < a.high.x && a.low.y < b.high.y && b.low.y < a.high.y;
+}
+
+} // namespace
+
+auto draw_list::make_key(const int layer, const int index, const std::uint32_t texture) noexcept -> std::uint64_t {
+	return (biased(layer) << 48U) | (biased(index) << 32U) | (static_cast<std::uint64_t>(texture & 0xFFFFFFU) << 8U);
+}
+
+auto draw_list::clear() noexcept -> void {
+	commands_.clear();
+	sprites_.clear();
+	panels_.clear();
+	labels_.clear();
+	rich_labels_.clear();
+	glyphs_.clear();
+	rects_.clear();
+	circles_.clear();
+	quads_.clear();
+	caches_.clear();
+	constexpr auto infinity = std::numeric_limits<float>::infinity();
+	low_ = glm::vec2{-infinity, -infinity};
+	high_ = glm::vec2{infinity, infinity};
+}
+
+auto draw_list::sort() -> void {
+	std::ranges::sort(commands_, [](const draw_command &a, const draw_command &b) -> bool {
+		const auto a_order = a.key & order_mask;
+		const auto b_order = b.key & order_mask;
+		return a_order != b_order ? a_order < b_order : a.sequence < b.sequence;
+	});
+
+	const auto commands = std::span<draw_command>{commands_};
+	for(std::size_t begin = 0; begin < commands.size();) {
+		auto end = begin + 1;
+		while(end < commands.size() && (commands[end].key & order_mask) == (commands[begin].key & order_mask)) {
+			++end;
+		}
+		batch(commands.subspan(begin, end - begin));
+		begin = end;
+	}
+}
+
+// each command moves back next to the closest earlier one it batches with, unless it would pass one it overlaps
+auto draw_list::batch(const std::span<draw_command> run) -> void {
+	for(std::size_t i = 1; i < run.size(); ++i) {
+		const auto moving = run[i];
+		if((moving.key & texture_mask) == 0) {
+			continue; // untextured, nothing to batch
+		}
+
+		const auto stop = i > batch_window ? i - batch_window : 0;
+		for(auto j = i; j-- > stop;) {
+			if((run[j].key & batch_mask) == (moving.key & batch_mask)) {
+				std::rotate(run.begin() + static_cast<std::ptrdiff_t>(j + 1),
+							run.begin() + static_cast<std::ptrdiff_t>(i),
+							run.begin() + static_cast<std::ptrdiff_t>(i + 1));
+				break;
+			}
+			if(overlap(run[j], moving)) {
+				break;
+			}
+		}
+	}
+}
+
+auto draw_list::add(const std::uint64_t key, const sprite_draw &draw) -> void {
+	push(key, draw_kind::sprite, sprites_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const panel_draw &draw) -> void {
+	push(key, draw_kind::panel, panels_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const label_draw &draw) -> void {
+	push(key, draw_kind::label, labels_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const rich_label_draw &draw) -> void {
+	push(key, draw_kind::rich_label, rich_labels_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const glyph_draw &draw) -> void {
+	push(key, draw_kind::glyphs, glyphs_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const rect_draw &draw) -> void {
+	push(key, draw_kind::rect, rects_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const circle_draw &draw) -> void {
+	push(key, draw_kind::circle, circles_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const quad_draw &draw) -> void {
+	push(key, draw_kind::quad, quads_, draw);
+}
+
+auto draw_list::add(const std::uint64_t key, const cache_draw &draw) -> void {
+	push(key, draw_kind::cache, caches_, draw);
+}
+
+} // namespace lge
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "narrow_phase.hpp"
+
+#include <lge/internal/components/bounds.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/geometric.hpp>
+#include <limits>
+#include <span>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	define LGE_NARROW_PHASE_SSE 1
+#	include <xmmintrin.h>
+#else
+#	define LGE_NARROW_PHASE_SSE 0
+#endif
+
+namespace lge {
+
+namespace {
+
+struct projection {
+	float min;
+	float max;
+};
+
+auto edge_normal(const glm::vec2 &from, const glm::vec2 &to) noexcept -> glm::vec2 {
+	const auto edge = to - from;
+	return {-edge.y, edge.x};
+}
+
+auto project(const bounds &quad, const glm::vec2 &axis) noexcept -> projection {
+	const auto d0 = glm::dot(quad.p0, axis);
+	const auto d1 = glm::dot(quad.p1, axis);
+	const auto d2 = glm::dot(quad.p2, axis);
+	const auto d3 = glm::dot(quad.p3, axis);
+	return {.min = std::min({d0, d1, d2, d3}), .max = std::max({d0, d1, d2, d3})};
+}
+
+auto separated(const projection &a, const projection &b) noexcept -> bool {
+	return a.max < b.min || b.max < a.min;
+}
+
+auto sat_overlap(const std::array<glm::vec2, 3> &tri_a, const std::array<glm::vec2, 3> &tri_b) noexcept -> bool {
+	for(size_t i = 0; i < 3; ++i) {
+		const auto axis = edge_normal(tri_a[i], tri_a[(i + 1) % 3]);
+
+		auto min_a = std::numeric_limits<float>::max();
+		auto max_a = std::numeric_limits<float>::lowest();
+		for(const auto &v: tri_a) {
+			const auto proj = glm::dot(v, axis);
+			min_a = std::min(min_a, proj);
+			max_a = std::max(max_a, proj);
+		}
+
+		auto min_b = std::numeric_limits<float>::max();
+		auto max_b = std::numeric_limits<float>::lowest();
+		for(const auto &v: tri_b) {
+			const auto proj = glm::dot(v, axis);
+			min_b = std::min(min_b, proj);
+			max_b = std::max(max_b, proj);
+		}
+
+		if(max_a < min_b || max_b < min_a) {
+			return false;
+		}
+	}
+	return true;
+}
+
+auto triangles_intersect(const std::array<glm::vec2, 3> &ta, const std::array<glm::vec2, 3> &tb) noexcept -> bool {
+	return sat_overlap(ta, tb) && sat_overlap(tb, ta);
+}
+
+#if LGE_NARROW_PHASE_SSE
+struct lanes {
+	__m128 min;
+	__m128 max;
+};
+
+// the four corners of four quads, one quad per lane
+struct corner_lanes {
+	__m128 x[4]; // NOLINT(*-avoid-c-arrays)
+	__m128 y[4]; // NOLINT(*-avoid-c-arrays)
+};
+
+// projects the corners of every lane onto that lane's axis
+auto project_lanes(const corner_lanes &quads, const __m128 axis_x, const __m128 axis_y) noexcept -> lanes {
+	auto min = _mm_add_ps(_mm_mul_ps(quads.x[0], axis_x), _mm_mul_ps(quads.y[0], axis_y));
+	auto max = min;
+	for(size_t c = 1; c < 4; ++c) {
+		const auto d = _mm_add_ps(_mm_mul_ps(quads.x[c], axis_x), _mm_mul_ps(quads.y[c], axis_y));
+		min = _mm_min_ps(min, d);
+		max = _mm_max_ps(max, d);
+	}
+	return {.min = min, .max = max};
+}
+
+auto separated_lanes(const lanes &a, const lanes &b) noexcept -> __m128 {
+	return _mm_or_ps(_mm_cmplt_ps(a.max, b.min), _mm_cmplt_ps(b.max, a.min));
+}
+
+// returns a 4 bit mask with a bit set for every candidate that overlaps a
+auto overlap_mask(const bounds &a, const quad_batch &batch, const std::size_t first) noexcept -> int {
+	corner_lanes candidates{};
+	for(size_t c = 0; c < 4; ++c) {
+		candidates.x[c] = _mm_loadu_ps(batch.x(c) + first);
+		candidates.y[c] = _mm_loadu_ps(batch.y(c) + first);
+	}
+
+	// a's corners broadcast to every lane
+	const corner_lanes quad{
+		.x = {_mm_set1_ps(a.p0.x), _mm_set1_ps(a.p1.x), _mm_set1_ps(a.p2.x), _mm_set1_ps(a.p3.x)},
+		.y = {_mm_set1_ps(a.p0.y), _mm_set1_ps(a.p1.y), _mm_set1_ps(a.p2.y), _mm_set1_ps(a.p3.y)},
+	};
+
+	auto apart = _mm_setzero_ps();
+
+	// a's axes are shared by every candidate
+	for(const auto &axis: {edge_normal(a.p0, a.p1), edge_normal(a.p1, a.p2)}) {
+		const auto pa = project(a, axis);
+		const auto a_lanes = lanes{.min = _mm_set1_ps(pa.min), .max = _mm_set1_ps(pa.max)};
+		const auto b_lanes = project_lanes(candidates, _mm_set1_ps(axis.x), _mm_set1_ps(axis.y));
+		apart = _mm_or_ps(apart, separated_lanes(a_lanes, b_lanes));
+	}
+
+	// each candidate brings its own axes
+	for(const auto &[from, to]: {std::array<size_t, 2>{0, 1}, std::array<size_t, 2>{1, 2}}) {
+		const auto axis_x = _mm_sub_ps(candidates.y[from], candidates.y[to]);
+		const auto axis_y = _mm_sub_ps(candidates.x[to], candidates.x[from]);
+		const auto a_lanes = project_lanes(quad, axis_x, axis_y);
+		const auto b_lanes = project_lanes(candidates, axis_x, axis_y);
+		apart = _mm_or_ps(apart, separated_lanes(a_lanes, b_lanes));
+	}
+
+	return ~_mm_movemask_ps(apart) & 0xF;
+}
+#endif
+
+} // namespace
+
+auto quad_batch::clear() noexcept -> void {
+	for(size_t c = 0; c < 4; ++c) {
+		x_[c].clear();
+		y_[c].clear();
+	}
+}
+
+auto quad_batch::push(const bounds &quad) -> void {
+	const std::array corners{quad.p0, quad.p1, quad.p2, quad.p3};
+	for(size_t c = 0; c < 4; ++c) {
+		x_[c].push_back(corners[c].x);
+		y_[c].push_back(corners[c].y);
+	}
+}
+
+auto quad_batch::at(const std::size_t index) const noexcept -> bounds {
+	return bounds{
+		.p0 = {x_[0][index], y_[0][index]},
+		.p1 = {x_[1][index], y_[1][index]},
+		.p2 = {x_[2][index], y_[2][index]},
+		.p3 = {x_[3][index], y_[3][index]},
+	};
+}
+
+auto quads_overlap(const bounds &a, const bounds &b) noexcept -> bool {
+	for(const auto &axis: {edge_normal(a.p0, a.p1), edge_normal(a.p1, a.p2), edge_normal(b.p0, b.p1),
+						   edge_normal(b.p1, b.p2)}) {
+		if(separated(project(a, axis), project(b, axis))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+auto quads_overlap_batch(const bounds &a, const quad_batch &batch, const std::span<std::uint8_t> hits) noexcept
+	-> void {
+	std::size_t i = 0;
+#if LGE_NARROW_PHASE_SSE
+	for(; i + 4 <= batch.size(); i += 4) {
+		const auto mask = overlap_mask(a, batch, i);
+		for(size_t lane = 0; lane < 4; ++lane) {
+			hits[i + lane] = static_cast<std::uint8_t>((mask >> lane) & 1);
+		}
+	}
+#endif
+	for(; i < batch.size(); ++i) {
+		hits[i] = quads_overlap(a, batch.at(i)) ? 1U : 0U;
+	}
+}
+
+auto quads_overlap_triangulated(const bounds &a, const bounds &b) noexcept -> bool {
+	// each world-space quad splits into two triangles: (p0,p1,p3) and (p1,p2,p3)
+	const std::array a0{a.p0, a.p1, a.p3};
+	const std::array a1{a.p1, a.p2, a.p3};
+	const std::array b0{b.p0, b.p1, b.p3};
+	const std::array b1{b.p1, b.p2, b.p3};
+	return triangles_intersect(a0, b0) || triangles_intersect(a0, b1) || triangles_intersect(a1, b0)
+		   || triangles_intersect(a1, b1);
+}
+
+} // namespace lge
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/internal/components/bounds.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Narrow phase for oriented quads
+//
+// Quads from bounds_system are parallelograms, so two edge normals per quad
+// are enough separating axes. quads_overlap_batch tests one quad against a
+// structure-of-arrays batch of candidates four at a time when SSE is available.
+// =============================================================================
+
+// corners of many quads, one array per coordinate, so candidates can be loaded lane by lane
+class quad_batch {
+public:
+	auto clear() noexcept -> void;
+	auto push(const bounds &quad) -> void;
+
+	[[nodiscard]] auto at(std::size_t index) const noexcept -> bounds;
+	[[nodiscard]] auto size() const noexcept -> std::size_t {
+		return x_[0].size();
+	}
+
+	[[nodiscard]] auto x(const std::size_t corner) const noexcept -> const float * {
+		return x_[corner].data();
+	}
+	[[nodiscard]] auto y(const std::size_t corner) const noexcept -> const float * {
+		return y_[corner].data();
+	}
+
+private:
+	std::array<std::vector<float>, 4> x_;
+	std::array<std::vector<float>, 4> y_;
+};
+
+// separating axis test on the two edge normals of each quad; touching quads overlap
+[[nodiscard]] auto quads_overlap(const bounds &a, const bounds &b) noexcept -> bool;
+
+// writes 1 into hits[i] when a overlaps batch quad i, hits must hold at least batch.size() entries
+auto quads_overlap_batch(const bounds &a, const quad_batch &batch, std::span<std::uint8_t> hits) noexcept -> void;
+
+// previous narrow phase, splitting each quad into two triangles; kept as the reference for tests and benchmarks
+[[nodiscard]] auto quads_overlap_triangulated(const bounds &a, const bounds &b) noexcept -> bool;
+
+} // namespace lge
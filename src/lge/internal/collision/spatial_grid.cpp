@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "spatial_grid.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_int2.hpp>
+#include <span>
+
+namespace lge {
+
+spatial_grid::spatial_grid(const float cell_size): inverse_cell_size_{1.F / cell_size} {
+	assert(cell_size > 0.F && std::isfinite(cell_size) && "cell size must be positive");
+}
+
+auto spatial_grid::range_of(const glm::vec2 &min, const glm::vec2 &max) const noexcept -> cell_range {
+	// NaN bounds make the widest range, so they end up oversized instead of in an arbitrary cell
+	const auto nan = std::isnan(min.x) || std::isnan(min.y) || std::isnan(max.x) || std::isnan(max.y);
+	if(nan) [[unlikely]] {
+		return cell_range{.min = {-max_coordinate, -max_coordinate}, .max = {max_coordinate, max_coordinate}};
+	}
+	return cell_range{
+		.min = {coordinate_of(min.x), coordinate_of(min.y)},
+		.max = {coordinate_of(max.x), coordinate_of(max.y)},
+	};
+}
+
+auto spatial_grid::insert(const entt::entity entity, const cell_range &range) -> void {
+	if(is_oversized(range)) [[unlikely]] {
+		oversized_.push_back(entity);
+		return;
+	}
+
+	for(auto y = range.min.y; y <= range.max.y; ++y) {
+		for(auto x = range.min.x; x <= range.max.x; ++x) {
+			auto &c = cells_[key_of(x, y)];
+			c.coords = {x, y};
+			c.entities.push_back(entity);
+		}
+	}
+}
+
+auto spatial_grid::remove(const entt::entity entity, const cell_range &range) -> void {
+	if(is_oversized(range)) [[unlikely]] {
+		if(const auto found = std::ranges::find(oversized_, entity); found != oversized_.end()) {
+			*found = oversized_.back();
+			oversized_.pop_back();
+		}
+		return;
+	}
+
+	for(auto y = range.min.y; y <= range.max.y; ++y) {
+		for(auto x = range.min.x; x <= range.max.x; ++x) {
+			const auto it = cells_.find(key_of(x, y));
+			if(it == cells_.end()) [[unlikely]] {
+				continue;
+			}
+
+			auto &entities = it->second.entities;
+			// order inside a cell does not matter, so swap with the last one instead of shifting
+			if(const auto found = std::ranges::find(entities, entity); found != entities.end()) {
+				*found = entities.back();
+				entities.pop_back();
+			}
+
+			if(entities.empty()) {
+				cells_.erase(it);
+			}
+		}
+	}
+}
+
+auto spatial_grid::entities_in(const glm::ivec2 &coords) const -> std::span<const entt::entity> {
+	if(const auto it = cells_.find(key_of(coords.x, coords.y)); it != cells_.end()) {
+		return it->second.entities;
+	}
+	return {};
+}
+
+auto spatial_grid::coordinate_of(const float position) const noexcept -> int {
+	// clamped while still a float, casting one out of the int range is undefined
+	constexpr auto limit = static_cast<float>(max_coordinate);
+	return static_cast<int>(std::clamp(std::floor(position * inverse_cell_size_), -limit, limit));
+}
+
+auto spatial_grid::key_of(const int x, const int y) noexcept -> std::uint64_t {
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32U) | static_cast<std::uint32_t>(y);
+}
+
+} // namespace lge
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_int2.hpp>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace lge {
+
+// inclusive range of grid cells covered by an axis-aligned box
+struct cell_range {
+	glm::ivec2 min;
+	glm::ivec2 max;
+
+	auto operator==(const cell_range &) const -> bool = default;
+
+	[[nodiscard]] auto cell_count() const noexcept -> std::int64_t {
+		return (static_cast<std::int64_t>(max.x) - min.x + 1) * (static_cast<std::int64_t>(max.y) - min.y + 1);
+	}
+};
+
+// =============================================================================
+// Uniform spatial grid
+//
+// Entities are listed in every cell their AABB touches. Cells are created on
+// demand and dropped when they become empty, so only occupied space costs
+// memory or iteration time. An entity covering more than max_cells_per_entity
+// cells, e.g. a huge or far away box, is kept apart in an oversized list, so it
+// never fills the grid with cells; callers test those against everything.
+// =============================================================================
+
+class spatial_grid {
+public:
+	static constexpr std::int64_t max_cells_per_entity = 64;
+	// cell coordinates are clamped to this, far enough for any world and exact as a float
+	static constexpr int max_coordinate = 1 << 24;
+
+	// cell_size must be positive
+	explicit spatial_grid(float cell_size);
+
+	// any bounds give a valid range, even NaN or infinite ones, which end up oversized or clamped
+	[[nodiscard]] auto range_of(const glm::vec2 &min, const glm::vec2 &max) const noexcept -> cell_range;
+
+	[[nodiscard]] static auto is_oversized(const cell_range &range) noexcept -> bool {
+		return range.cell_count() > max_cells_per_entity;
+	}
+
+	auto insert(entt::entity entity, const cell_range &range) -> void;
+	auto remove(entt::entity entity, const cell_range &range) -> void;
+
+	[[nodiscard]] auto entities_in(const glm::ivec2 &coords) const -> std::span<const entt::entity>;
+	[[nodiscard]] auto cell_count() const noexcept -> std::size_t {
+		return cells_.size();
+	}
+
+	// entities with an oversized range, listed in no cell
+	[[nodiscard]] auto oversized() const noexcept -> std::span<const entt::entity> {
+		return oversized_;
+	}
+
+	// calls fn(cell coordinates, entities in the cell) for every occupied cell
+	template<typename Fn>
+	auto for_each_cell(Fn &&fn) const -> void {
+		for(const auto &[key, c]: cells_) {
+			fn(c.coords, std::span<const entt::entity>{c.entities});
+		}
+	}
+
+private:
+	struct cell {
+		glm::ivec2 coords;
+		std::vector<entt::entity> entities;
+	};
+
+	float inverse_cell_size_;
+	std::unordered_map<std::uint64_t, cell> cells_;
+	std::vector<entt::entity> oversized_;
+
+	[[nodiscard]] auto coordinate_of(float position) const noexcept -> int;
+	[[nodiscard]] static auto key_of(int x, int y) noexcept -> std::uint64_t;
+};
+
+} // namespace lge
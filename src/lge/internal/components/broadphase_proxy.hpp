@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/internal/collision/spatial_grid.hpp>
+
+#include <cstdint>
+#include <glm/ext/vector_float2.hpp>
+
+namespace lge {
+
+// world AABB of a collidable, its collision filter and the grid cells it is currently listed in
+struct broadphase_proxy {
+	glm::vec2 min;
+	glm::vec2 max;
+	cell_range cells;
+	std::uint32_t layer;
+	std::uint32_t mask;
+};
+
+} // namespace lge
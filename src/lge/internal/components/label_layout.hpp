@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/text/glyph_layout.hpp>
+
+#include <cstdint>
+
+namespace lge {
+
+// a label's text laid out when it last changed, drawn as is every frame
+struct label_layout {
+	glyph_layout glyphs;
+	std::uint64_t text_hash; // of the text laid out, so a change is told without reading the text again
+};
+
+} // namespace lge
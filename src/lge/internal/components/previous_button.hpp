@@ -3,12 +3,18 @@
 
 #pragma once
 
+#include <lge/interface/resources.hpp>
+
 #include <glm/ext/vector_float2.hpp>
+#include <string>
 
 namespace lge {
 
 struct previous_button {
 	glm::vec2 size{};
+	std::string text;
+	float text_size = 17.0F;
+	font_handle font;
 };
 
 } // namespace lge
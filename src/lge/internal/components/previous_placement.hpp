@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/components/placement.hpp>
+
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <glm/ext/vector_float2.hpp>
+
+namespace lge {
+
+// inputs the current transform was composed from
+struct previous_placement {
+	placement local;
+	glm::vec2 pivot_offset{};
+	entt::entity parent_id{entt::null};
+};
+
+} // namespace lge
@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/interface/resources.hpp>
+
+#include <cstdint>
+#include <entt/core/fwd.hpp>
+
+namespace lge {
+
+// sheet frame of a sprite, panel or button resolved by metrics_system, and what it was resolved from
+struct sprite_source {
+	sprite_sheet_handle sheet;
+	entt::id_type frame;
+	std::uint32_t generation;
+	resolved_frame resolved;
+};
+
+} // namespace lge
@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <glm/ext/vector_float2.hpp>
+
+namespace lge {
+
+// measured size of a caption drawn inside the entity, e.g. a button's text, its metrics being the button's own size
+struct text_metrics {
+	glm::vec2 size;
+	std::uint64_t text_hash; // of the text measured, so a change is told without reading the text again
+};
+
+} // namespace lge
@@ -3,14 +3,24 @@
 
 #pragma once
 
-#include <glm/ext/matrix_float3x3.hpp>
+#include <glm/ext/vector_float2.hpp>
 
 namespace lge {
 
-// full 2D affine transform
+// 2D affine transform from local to world space, kept decomposed so consumers never extract
+// rotation or scale back out of a matrix
 struct transform {
-	glm::mat3 world;
-	glm::mat3 attachment;
+	glm::vec2 origin;  // world position of the local (0, 0) corner
+	glm::vec2 scale;   // accumulated world scale
+	float rotation;	   // accumulated world rotation in degrees
+	float sin;		   // sine of rotation
+	float cos;		   // cosine of rotation
+
+	[[nodiscard]] auto apply(const glm::vec2 &local) const noexcept -> glm::vec2 {
+		return origin
+			   + glm::vec2{(cos * scale.x * local.x) + (sin * scale.x * local.y),
+						   -(sin * scale.y * local.x) + (cos * scale.y * local.y)};
+	}
 };
 
 } // namespace lge
\ No newline at end of file
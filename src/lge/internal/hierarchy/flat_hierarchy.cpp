@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "flat_hierarchy.hpp"
+
+#include <lge/components/hierarchy.hpp>
+
+#include <cstdint>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <ranges>
+
+namespace lge {
+
+auto flat_hierarchy::of(entt::registry &world) -> const flat_hierarchy & {
+	auto *hierarchy = world.ctx().find<flat_hierarchy>();
+	if(hierarchy == nullptr) [[unlikely]] {
+		hierarchy = &world.ctx().emplace<flat_hierarchy>();
+		world.on_construct<parent>().connect<&flat_hierarchy::invalidate>();
+		world.on_update<parent>().connect<&flat_hierarchy::invalidate>();
+		world.on_destroy<parent>().connect<&flat_hierarchy::invalidate>();
+		world.on_destroy<children>().connect<&flat_hierarchy::invalidate>();
+	}
+
+	if(hierarchy->dirty_) [[unlikely]] {
+		hierarchy->rebuild(world);
+	}
+
+	return *hierarchy;
+}
+
+auto flat_hierarchy::rebuild(const entt::registry &world) -> void {
+	entities_.clear();
+	parents_.clear();
+
+	for(const auto root: world.view<children>(entt::exclude<parent>)) {
+		rebuild_stack_.emplace_back(root, no_parent);
+
+		while(!rebuild_stack_.empty()) {
+			const auto [entity, parent_index] = rebuild_stack_.back();
+			rebuild_stack_.pop_back();
+
+			if(!world.valid(entity)) [[unlikely]] {
+				continue;
+			}
+
+			const auto index = static_cast<std::uint32_t>(entities_.size());
+			entities_.push_back(entity);
+			parents_.push_back(parent_index);
+
+			// reversed so siblings keep their children order in the flattened array
+			if(const auto *kids = world.try_get<children>(entity); kids != nullptr) {
+				for(const auto child: std::views::reverse(kids->ids)) {
+					rebuild_stack_.emplace_back(child, index);
+				}
+			}
+		}
+	}
+
+	dirty_ = false;
+}
+
+auto flat_hierarchy::invalidate(entt::registry &world, const entt::entity /*entity*/) -> void {
+	world.ctx().get<flat_hierarchy>().dirty_ = true;
+}
+
+} // namespace lge
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Flattened hierarchy
+//
+// Every entity that has a parent or children, in depth-first pre-order: a
+// parent always comes before its descendants and each root's subtree is a
+// contiguous range. parents()[i] is the index of the parent of entities()[i],
+// or no_parent for roots.
+//
+// One instance lives in the registry context and is shared by every system
+// that propagates state down the hierarchy. It is rebuilt lazily, only after
+// a parent link has been created, changed or destroyed. Systems running at the
+// same time only read it: the app rebuilds it before starting their batch.
+// =============================================================================
+
+class flat_hierarchy {
+public:
+	static constexpr auto no_parent = std::numeric_limits<std::uint32_t>::max();
+
+	// returns the world's hierarchy, rebuilt if it changed since the last call
+	[[nodiscard]] static auto of(entt::registry &world) -> const flat_hierarchy &;
+
+	[[nodiscard]] auto entities() const noexcept -> std::span<const entt::entity> {
+		return entities_;
+	}
+
+	[[nodiscard]] auto parents() const noexcept -> std::span<const std::uint32_t> {
+		return parents_;
+	}
+
+	[[nodiscard]] auto size() const noexcept -> std::size_t {
+		return entities_.size();
+	}
+
+private:
+	std::vector<entt::entity> entities_;
+	std::vector<std::uint32_t> parents_;
+	std::vector<std::pair<entt::entity, std::uint32_t>> rebuild_stack_;
+	bool dirty_ = true;
+
+	auto rebuild(const entt::registry &world) -> void;
+	static auto invalidate(entt::registry &world, entt::entity entity) -> void;
+};
+
+} // namespace lge
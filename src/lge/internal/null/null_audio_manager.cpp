@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/log.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/null/null_audio_manager.hpp>
+#include <lge/internal/null/null_resource_manager.hpp>
+
+namespace lge {
+
+auto null_audio_manager::init() -> result<> {
+	log::debug("initializing null audio manager");
+	return true;
+}
+
+auto null_audio_manager::end() -> result<> {
+	log::debug("ending null audio manager");
+	stop_all();
+	return true;
+}
+
+auto null_audio_manager::play_sound(const sound_handle handle) noexcept -> result<> {
+	if(!resource_manager_.has_sound(handle)) [[unlikely]] {
+		return error("sound handle not found");
+	}
+	return true;
+}
+
+auto null_audio_manager::play_music(const music_handle handle) noexcept -> result<> {
+	if(!resource_manager_.has_music(handle)) [[unlikely]] {
+		return error("music handle not found");
+	}
+	current_music_ = handle;
+	music_playing_ = true;
+	return true;
+}
+
+auto null_audio_manager::stop_music() noexcept -> result<> {
+	if(current_music_ == invalid_music) {
+		log::warn("attempted to stop music when no music is currently playing");
+		return true;
+	}
+	current_music_ = invalid_music;
+	music_playing_ = false;
+	return true;
+}
+
+auto null_audio_manager::pause_music() noexcept -> result<> {
+	if(current_music_ == invalid_music) {
+		log::warn("attempted to pause music when no music is currently playing");
+		return true;
+	}
+	music_playing_ = false;
+	return true;
+}
+
+auto null_audio_manager::resume_music() noexcept -> result<> {
+	if(current_music_ == invalid_music) {
+		log::warn("attempted to resume music when no music is currently playing");
+		return true;
+	}
+	music_playing_ = true;
+	return true;
+}
+
+auto null_audio_manager::is_music_playing() const noexcept -> bool {
+	return music_playing_;
+}
+
+auto null_audio_manager::update_music() noexcept -> result<> {
+	return true;
+}
+
+auto null_audio_manager::stop_all() noexcept -> void {
+	current_music_ = invalid_music;
+	music_playing_ = false;
+}
+
+} // namespace lge
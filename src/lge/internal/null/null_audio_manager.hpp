@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/result.hpp>
+#include <lge/interface/audio_manager.hpp>
+#include <lge/interface/resources.hpp>
+
+namespace lge {
+
+class null_resource_manager;
+
+// validates handles and tracks music state without opening an audio device
+class null_audio_manager final: public audio_manager {
+public:
+	explicit null_audio_manager(null_resource_manager &resource_manager) noexcept
+		: resource_manager_{resource_manager} {}
+
+	[[nodiscard]] auto init() -> result<> override;
+	[[nodiscard]] auto end() -> result<> override;
+
+	[[nodiscard]] auto play_sound(sound_handle handle) noexcept -> result<> override;
+
+	[[nodiscard]] auto play_music(music_handle handle) noexcept -> result<> override;
+	[[nodiscard]] auto stop_music() noexcept -> result<> override;
+	[[nodiscard]] auto pause_music() noexcept -> result<> override;
+	[[nodiscard]] auto resume_music() noexcept -> result<> override;
+	[[nodiscard]] auto is_music_playing() const noexcept -> bool override;
+	[[nodiscard]] auto update_music() noexcept -> result<> override;
+
+	auto stop_all() noexcept -> void override;
+
+private:
+	null_resource_manager &resource_manager_; // NOLINT(*-avoid-const-or-ref-data-members)
+	music_handle current_music_{invalid_music};
+	bool music_playing_{false};
+};
+
+} // namespace lge
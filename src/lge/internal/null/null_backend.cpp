@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "null_backend.hpp"
+
+#include <lge/interface/backend.hpp>
+#include <lge/internal/null/null_audio_manager.hpp>
+#include <lge/internal/null/null_input.hpp>
+#include <lge/internal/null/null_renderer.hpp>
+#include <lge/internal/null/null_resource_manager.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace lge::null_backend {
+
+auto create(const float frame_time) -> backend {
+	auto resource_manager = std::make_shared<null_resource_manager>();
+	auto renderer = std::make_unique<null_renderer>(*resource_manager, frame_time);
+	auto input = std::make_unique<null_input>();
+	auto audio = std::make_shared<null_audio_manager>(*resource_manager);
+
+	return backend{
+		.renderer_ptr = std::move(renderer),
+		.input_ptr = std::move(input),
+		.resource_manager_ptr = resource_manager,
+		.audio_manager_ptr = std::move(audio),
+	};
+}
+
+} // namespace lge::null_backend
@@ -0,0 +1,13 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/interface/backend.hpp>
+
+namespace lge::null_backend {
+
+// headless backend: no window, GL context or audio device, every frame lasts frame_time seconds
+[[nodiscard]] auto create(float frame_time = 1.F / 60.F) -> backend;
+
+} // namespace lge::null_backend
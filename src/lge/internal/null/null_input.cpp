@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "null_input.hpp"
+
+#include <cstddef>
+#include <glm/ext/vector_float2.hpp>
+
+namespace lge {
+
+auto null_input::update(float /*delta_time*/) -> void {
+	reset_states();
+	for(std::size_t bid = 0; bid < max_actions; ++bid) {
+		states[bid].pressed = queued_[bid].pressed;
+		states[bid].released = queued_[bid].released;
+	}
+	queued_ = {};
+}
+
+auto null_input::get_mouse_position() const -> glm::vec2 {
+	return mouse_position_;
+}
+
+auto null_input::is_mouse_button_pressed(size_t /*button*/) const -> bool {
+	return false;
+}
+
+auto null_input::get_button_state(button /*b*/) const -> state {
+	return {};
+}
+
+} // namespace lge
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/interface/input.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <glm/ext/vector_float2.hpp>
+
+namespace lge {
+
+// input with no devices, the mouse stays where it was last placed and actions are only pressed when told to
+class null_input: public input {
+public:
+	auto update(float delta_time) -> void override;
+
+	[[nodiscard]] auto get_mouse_position() const -> glm::vec2 override;
+	[[nodiscard]] auto is_mouse_button_pressed(size_t button) const -> bool override;
+	[[nodiscard]] auto get_button_state(button b) const -> state override;
+
+	auto set_mouse_position(const glm::vec2 &position) noexcept -> void {
+		mouse_position_ = position;
+	}
+
+	// the action is pressed or released on the next update only
+	auto press(const id action) noexcept -> void {
+		assert(action < max_actions && "action id exceeds max_actions");
+		queued_[action].pressed = true;
+	}
+
+	auto release(const id action) noexcept -> void {
+		assert(action < max_actions && "action id exceeds max_actions");
+		queued_[action].released = true;
+	}
+
+private:
+	glm::vec2 mouse_position_{};
+	std::array<state, max_actions> queued_{};
+};
+
+} // namespace lge
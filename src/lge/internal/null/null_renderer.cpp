@@ -0,0 +1,333 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "null_renderer.hpp"
+
+#include <lge/app/app_config.hpp>
+#include <lge/core/colors.hpp>
+#include <lge/core/log.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/interface/renderer.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/text/rich_text.hpp>
+#include <lge/text/glyph_layout.hpp>
+#include <lge/text/text_segment.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <entt/core/fwd.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace lge {
+
+// fixed advance per glyph, as a fraction of the font size, so label metrics do not depend on font files
+constexpr auto null_glyph_advance = 0.5F;
+
+auto null_renderer::init(const app_config &config) -> result<> {
+	drawing_resolution_ = config.design_resolution;
+	initialized_ = true;
+	log::info("null_renderer initialized");
+	return true;
+}
+
+auto null_renderer::end() -> result<> {
+	if(!initialized_) [[unlikely]] {
+		return true;
+	}
+	initialized_ = false;
+	log::info("null_renderer ended after {} frames", frame_count_);
+	return true;
+}
+
+auto null_renderer::begin_frame() -> result<> {
+	if(!initialized_) [[unlikely]] {
+		return error("null_renderer not initialized");
+	}
+	recorded_.clear();
+	++frame_count_;
+	return true;
+}
+
+auto null_renderer::end_frame() const -> result<> {
+	if(!initialized_) [[unlikely]] {
+		return error("null_renderer not initialized");
+	}
+	return true;
+}
+
+auto null_renderer::should_close() const -> bool {
+	return false;
+}
+
+auto null_renderer::is_fullscreen() -> bool {
+	return fullscreen_;
+}
+
+auto null_renderer::set_fullscreen(const bool fullscreen) -> void {
+	fullscreen_ = fullscreen;
+}
+
+auto null_renderer::toggle_fullscreen() -> void {
+	fullscreen_ = !fullscreen_;
+}
+
+auto null_renderer::get_label_size(font_handle /*font*/, const std::string &text, const int &size) -> glm::vec2 {
+	std::size_t lines = 1;
+	std::size_t longest = 0;
+	std::size_t current = 0;
+	for_each_plain_run(text, [&](const std::string_view run) -> void {
+		for(const auto c: run) {
+			if(c == '\n') {
+				++lines;
+				current = 0;
+				continue;
+			}
+			longest = std::max(longest, ++current);
+		}
+	});
+
+	const auto glyph_size = static_cast<float>(size);
+	return {static_cast<float>(longest) * glyph_size * null_glyph_advance, static_cast<float>(lines) * glyph_size};
+}
+
+// one quad per glyph on the same fixed advance get_label_size measures with
+auto null_renderer::layout_label(const font_handle font,
+								 const std::string &text,
+								 const int &size,
+								 const color &text_color) -> glyph_layout {
+	const auto glyph_size = static_cast<float>(size);
+	const auto advance = glyph_size * null_glyph_advance;
+
+	glyph_layout layout{.font = font, .size = glyph_size, .glyphs = {}};
+	auto x = 0.0F;
+	auto y = 0.0F;
+
+	for(const auto &seg: parse_rich_text(text, text_color)) {
+		for(const auto c: seg.view(text)) {
+			if(c == '\n') {
+				x = 0.0F;
+				y += glyph_size;
+				continue;
+			}
+			if(c != ' ' && c != '\t') {
+				layout.glyphs.push_back({
+					.source_pos = {},
+					.source_size = {advance, glyph_size},
+					.offset = {x, y},
+					.size = {advance, glyph_size},
+					.tint = seg.segment_color,
+				});
+			}
+			x += advance;
+		}
+	}
+
+	return layout;
+}
+
+auto null_renderer::get_texture_size(const texture_handle texture) -> glm::vec2 {
+	glm::vec2 size{};
+	if(const auto err = resource_manager_.get_texture_size(texture).unwrap(size); err) [[unlikely]] {
+		log::error("failed to get texture with id {}", texture);
+		return {0.0F, 0.0F};
+	}
+	return size;
+}
+
+auto null_renderer::get_sprite_frame_size(const sprite_sheet_handle sheet, const entt::id_type frame) -> glm::vec2 {
+	sprite_sheet_frame f{};
+	if(const auto err = resource_manager_.get_sprite_sheet_frame(sheet, frame).unwrap(f); err) [[unlikely]] {
+		log::error("failed to get sprite sheet frame '{}' from sheet {}", frame, sheet);
+		return {0.0F, 0.0F};
+	}
+	return f.source_size;
+}
+
+auto null_renderer::resolve_sprite_frame(const sprite_sheet_handle sheet, const entt::id_type frame) const
+	-> result<resolved_frame> {
+	sprite_sheet_frame f{};
+	if(const auto err = resource_manager_.get_sprite_sheet_frame(sheet, frame).unwrap(f); err) [[unlikely]] {
+		return error("failed to resolve sprite frame", *err);
+	}
+
+	texture_handle tex_handle{};
+	if(const auto err = resource_manager_.get_sprite_sheet_texture(sheet).unwrap(tex_handle); err) [[unlikely]] {
+		return error("failed to resolve sprite sheet texture", *err);
+	}
+
+	glm::vec2 texture_size{};
+	if(const auto err = resource_manager_.get_texture_size(tex_handle).unwrap(texture_size); err) [[unlikely]] {
+		return error("failed to resolve null texture", *err);
+	}
+
+	// there is no GPU object, the texture handle stands in for its id
+	return resolved_frame{
+		.texture_id = tex_handle.raw(),
+		.texture_size = texture_size,
+		.source_pos = f.source_pos,
+		.source_size = f.source_size,
+	};
+}
+
+auto null_renderer::show_cursor(bool /*show*/) -> void {}
+
+auto null_renderer::get_delta_time() -> float {
+	return frame_time_;
+}
+
+auto null_renderer::get_drawing_resolution() const -> glm::vec2 {
+	return drawing_resolution_;
+}
+
+auto null_renderer::render_label(font_handle /*font*/,
+								 const std::string & /*text*/,
+								 const int & /*size*/,
+								 const color & /*color*/,
+								 const glm::vec2 & /*pivot_position*/,
+								 const glm::vec2 & /*rotated_offset*/,
+								 float /*rotation*/) const -> void {
+	record(draw_kind::label);
+}
+
+auto null_renderer::render_rich_label(font_handle /*font*/,
+									  const std::string & /*text*/,
+									  std::span<const text_segment> /*segments*/,
+									  const int & /*size*/,
+									  const glm::vec2 & /*pivot_position*/,
+									  const glm::vec2 & /*rotated_offset*/,
+									  float /*rotation*/) const -> void {
+	record(draw_kind::rich_label);
+}
+
+auto null_renderer::render_glyphs(const glyph_layout & /*layout*/,
+								  float /*scale*/,
+								  const glm::vec2 & /*pivot_position*/,
+								  const glm::vec2 & /*rotated_offset*/,
+								  float /*rotation*/) const -> void {
+	record(draw_kind::glyphs);
+}
+
+auto null_renderer::render_sprite(const sprite_sheet_handle sheet,
+								  const entt::id_type frame,
+								  const glm::vec2 & /*pivot_position*/,
+								  const glm::vec2 & /*size*/,
+								  const glm::vec2 & /*pivot*/,
+								  float /*rotation*/,
+								  bool /*flip_horizontal*/,
+								  bool /*flip_vertical*/,
+								  color /*tint*/) const -> void {
+	resolved_frame source{};
+	if(const auto err = resolve_sprite_frame(sheet, frame).unwrap(source); err) [[unlikely]] {
+		return;
+	}
+	record(draw_kind::sprite, source.texture_id);
+}
+
+auto null_renderer::render_panel(const sprite_sheet_handle sheet,
+								 const entt::id_type frame,
+								 const glm::vec2 & /*pivot_position*/,
+								 const glm::vec2 & /*size*/,
+								 const glm::vec2 & /*pivot*/,
+								 float /*rotation*/,
+								 float /*border*/,
+								 color /*tint*/) const -> void {
+	resolved_frame source{};
+	if(const auto err = resolve_sprite_frame(sheet, frame).unwrap(source); err) [[unlikely]] {
+		return;
+	}
+	record(draw_kind::panel, source.texture_id);
+}
+
+auto null_renderer::submit(const draw_list &list) const -> void {
+	for(const auto &cmd: list.commands()) {
+		switch(cmd.kind) {
+		case draw_kind::sprite: {
+			const auto &d = list.sprites()[cmd.payload];
+			if(d.source.texture_id != 0) [[likely]] {
+				record(draw_kind::sprite, d.source.texture_id);
+			} else {
+				render_sprite(d.sheet,
+							  d.frame,
+							  d.pivot_position,
+							  d.size,
+							  d.pivot,
+							  d.rotation,
+							  d.flip_horizontal,
+							  d.flip_vertical,
+							  d.tint);
+			}
+			break;
+		}
+		case draw_kind::panel: {
+			const auto &d = list.panels()[cmd.payload];
+			if(d.source.texture_id != 0) [[likely]] {
+				record(draw_kind::panel, d.source.texture_id);
+			} else {
+				render_panel(d.sheet, d.frame, d.pivot_position, d.size, d.pivot, d.rotation, d.border, d.tint);
+			}
+			break;
+		}
+		default:
+			record(cmd.kind);
+			break;
+		}
+	}
+}
+
+auto null_renderer::render_to_cache(const std::uint32_t cache,
+									const glm::vec2 & /*origin*/,
+									const glm::vec2 & /*size*/,
+									const draw_list & /*list*/) -> void {
+	caches_.insert(cache);
+	++cache_renders_;
+}
+
+auto null_renderer::release_cache(const std::uint32_t cache) -> void {
+	caches_.erase(cache);
+}
+
+auto null_renderer::render_quad(const glm::vec2 & /*p0*/,
+								const glm::vec2 & /*p1*/,
+								const glm::vec2 & /*p2*/,
+								const glm::vec2 & /*p3*/,
+								const color & /*color*/) const -> void {
+	record(draw_kind::quad);
+}
+
+auto null_renderer::render_rect(const glm::vec2 & /*center*/,
+								const glm::vec2 & /*size*/,
+								float /*rotation*/,
+								const color & /*border_color*/,
+								const color & /*fill_color*/,
+								float /*border_thickness*/) const -> void {
+	record(draw_kind::rect);
+}
+
+auto null_renderer::render_circle(const glm::vec2 & /*center*/,
+								  float /*radius*/,
+								  const color & /*border_color*/,
+								  const color & /*fill_color*/,
+								  float /*border_thickness*/) const -> void {
+	record(draw_kind::circle);
+}
+
+auto null_renderer::set_clear_color(const color & /*clear_color*/) -> void {}
+
+auto null_renderer::screen_to_world(const glm::vec2 &screen_position) const -> glm::vec2 {
+	// the screen is the drawing resolution at scale 1
+	return screen_position - (drawing_resolution_ * 0.5F);
+}
+
+auto null_renderer::set_cursor(cursor_type /*type*/) -> void {}
+
+auto null_renderer::recorded_count(const draw_kind kind) const noexcept -> std::size_t {
+	return static_cast<std::size_t>(
+		std::ranges::count_if(recorded_, [kind](const recorded_draw &d) -> bool { return d.kind == kind; }));
+}
+
+} // namespace lge
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/app/app_config.hpp>
+#include <lge/core/colors.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/interface/renderer.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/null/null_resource_manager.hpp>
+#include <lge/text/glyph_layout.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <entt/core/fwd.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <span>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace lge {
+
+// a draw the null renderer received, texture is the backend texture id for sprites and panels, otherwise 0
+struct recorded_draw {
+	draw_kind kind;
+	std::uint32_t texture;
+};
+
+// renderer without a window: frames last a fixed time and draws are recorded instead of issued
+class null_renderer: public renderer {
+public:
+	explicit null_renderer(null_resource_manager &rm, const float frame_time)
+		: resource_manager_{rm}, frame_time_{frame_time} {};
+	~null_renderer() override = default;
+
+	null_renderer(const null_renderer &) = delete;
+	null_renderer(null_renderer &&) = delete;
+	auto operator=(const null_renderer &) -> null_renderer & = delete;
+	auto operator=(null_renderer &&) -> null_renderer & = delete;
+
+	[[nodiscard]] auto init(const app_config &config) -> result<> override;
+	[[nodiscard]] auto end() -> result<> override;
+
+	[[nodiscard]] auto begin_frame() -> result<> override;
+	[[nodiscard]] auto end_frame() const -> result<> override;
+
+	[[nodiscard]] auto should_close() const -> bool override;
+
+	[[nodiscard]] auto is_fullscreen() -> bool override;
+	auto set_fullscreen(bool fullscreen) -> void override;
+	auto toggle_fullscreen() -> void override;
+
+	auto get_label_size(font_handle font, const std::string &text, const int &size) -> glm::vec2 override;
+	[[nodiscard]] auto layout_label(font_handle font, const std::string &text, const int &size, const color &text_color)
+		-> glyph_layout override;
+	auto get_texture_size(texture_handle texture) -> glm::vec2 override;
+	auto get_sprite_frame_size(sprite_sheet_handle sheet, entt::id_type frame) -> glm::vec2 override;
+	[[nodiscard]] auto resolve_sprite_frame(sprite_sheet_handle sheet, entt::id_type frame) const
+		-> result<resolved_frame> override;
+
+	auto show_cursor(bool show) -> void override;
+
+	auto get_delta_time() -> float override;
+
+	[[nodiscard]] auto get_drawing_resolution() const -> glm::vec2 override;
+
+	auto render_label(font_handle font,
+					  const std::string &text,
+					  const int &size,
+					  const color &color,
+					  const glm::vec2 &pivot_position,
+					  const glm::vec2 &rotated_offset,
+					  float rotation) const -> void override;
+
+	auto render_rich_label(font_handle font,
+						   const std::string &text,
+						   std::span<const text_segment> segments,
+						   const int &size,
+						   const glm::vec2 &pivot_position,
+						   const glm::vec2 &rotated_offset,
+						   float rotation) const -> void override;
+
+	auto render_glyphs(const glyph_layout &layout,
+					   float scale,
+					   const glm::vec2 &pivot_position,
+					   const glm::vec2 &rotated_offset,
+					   float rotation) const -> void override;
+
+	auto render_sprite(sprite_sheet_handle sheet,
+					   entt::id_type frame,
+					   const glm::vec2 &pivot_position,
+					   const glm::vec2 &size,
+					   const glm::vec2 &pivot,
+					   float rotation,
+					   bool flip_horizontal,
+					   bool flip_vertical,
+					   color tint) const -> void override;
+
+	auto render_panel(sprite_sheet_handle sheet,
+					  entt::id_type frame,
+					  const glm::vec2 &pivot_position,
+					  const glm::vec2 &size,
+					  const glm::vec2 &pivot,
+					  float rotation,
+					  float border,
+					  color tint) const -> void override;
+
+	auto submit(const draw_list &list) const -> void override;
+
+	auto render_to_cache(std::uint32_t cache, const glm::vec2 &origin, const glm::vec2 &size, const draw_list &list)
+		-> void override;
+	auto release_cache(std::uint32_t cache) -> void override;
+
+	auto render_quad(const glm::vec2 &p0,
+					 const glm::vec2 &p1,
+					 const glm::vec2 &p2,
+					 const glm::vec2 &p3,
+					 const color &color) const -> void override;
+
+	auto render_rect(const glm::vec2 &center,
+					 const glm::vec2 &size,
+					 float rotation,
+					 const color &border_color,
+					 const color &fill_color,
+					 float border_thickness) const -> void override;
+
+	auto render_circle(const glm::vec2 &center,
+					   float radius,
+					   const color &border_color,
+					   const color &fill_color,
+					   float border_thickness) const -> void override;
+
+	auto set_clear_color(const color &clear_color) -> void override;
+
+	[[nodiscard]] auto screen_to_world(const glm::vec2 &screen_position) const -> glm::vec2 override;
+
+	auto set_cursor(cursor_type type) -> void override;
+
+	// =============================================================================
+	// Recording
+	// =============================================================================
+
+	// draws received since the current frame began
+	[[nodiscard]] auto recorded_draws() const noexcept -> std::span<const recorded_draw> {
+		return recorded_;
+	}
+
+	[[nodiscard]] auto recorded_count(draw_kind kind) const noexcept -> std::size_t;
+
+	[[nodiscard]] auto frame_count() const noexcept -> std::size_t {
+		return frame_count_;
+	}
+
+	// times a cache texture was drawn into, and the caches currently held
+	[[nodiscard]] auto cache_render_count() const noexcept -> std::size_t {
+		return cache_renders_;
+	}
+
+	[[nodiscard]] auto cache_count() const noexcept -> std::size_t {
+		return caches_.size();
+	}
+
+private:
+	null_resource_manager &resource_manager_;
+	float frame_time_;
+
+	bool initialized_ = false;
+	bool fullscreen_ = false;
+	glm::vec2 drawing_resolution_{};
+	std::size_t frame_count_ = 0;
+	std::size_t cache_renders_ = 0;
+	std::unordered_set<std::uint32_t> caches_;
+
+	// render calls are const on the interface, recording them is not observable drawing state
+	mutable std::vector<recorded_draw> recorded_;
+
+	auto record(draw_kind kind, std::uint32_t texture = 0) const -> void {
+		recorded_.push_back({.kind = kind, .texture = texture});
+	}
+};
+
+} // namespace lge
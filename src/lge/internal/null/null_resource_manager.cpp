@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "null_resource_manager.hpp"
+
+#include <lge/core/log.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/null/null_resources.hpp>
+#include <lge/internal/resource_manager/async_loader.hpp>
+
+#include <glm/ext/vector_float2.hpp>
+#include <string>
+#include <string_view>
+
+namespace lge {
+
+// =============================================================================
+// Init / end
+// =============================================================================
+
+auto null_resource_manager::init() -> result<> {
+	log::debug("initializing null resource manager");
+	return true;
+}
+
+auto null_resource_manager::end() -> result<> {
+	log::debug("ending null resource manager");
+	stop_loads();
+	return true;
+}
+
+// =============================================================================
+// Font
+// =============================================================================
+
+auto null_resource_manager::load_font(const std::string_view uri) -> result<font_handle> {
+	if(!exists(uri)) [[unlikely]] {
+		return error("font file does not exist: " + std::string(uri));
+	}
+
+	font_handle handle;
+	if(const auto err = fonts_.load(uri).unwrap(handle); err) [[unlikely]] {
+		return error("failed to load font", *err);
+	}
+	return handle;
+}
+
+auto null_resource_manager::unload_font(const font_handle handle) -> result<> {
+	if(const auto err = fonts_.unload(handle).unwrap(); err) [[unlikely]] {
+		return error("failed to unload font", *err);
+	}
+	return true;
+}
+
+// =============================================================================
+// Texture
+// =============================================================================
+
+auto null_resource_manager::load_texture(const std::string_view uri) -> result<texture_handle> {
+	if(!exists(uri)) [[unlikely]] {
+		return error("texture file does not exist: " + std::string(uri));
+	}
+
+	texture_handle handle;
+	if(const auto err = textures_.load(uri).unwrap(handle); err) [[unlikely]] {
+		return error("failed to load texture", *err);
+	}
+	// it may have been pending, resolved as missing until now
+	bump_texture_generation();
+	return handle;
+}
+
+auto null_resource_manager::unload_texture(const texture_handle handle) -> result<> {
+	if(const auto err = textures_.unload(handle).unwrap(); err) [[unlikely]] {
+		return error("failed to unload texture", *err);
+	}
+	bump_texture_generation();
+	return true;
+}
+
+auto null_resource_manager::get_texture_size(const texture_handle handle) const -> result<glm::vec2> {
+	const null_texture *data = nullptr;
+	if(const auto err = textures_.get(handle).unwrap(data); err) [[unlikely]] {
+		return error("texture not found", *err);
+	}
+	return data->size;
+}
+
+auto null_resource_manager::load_texture_async(const std::string_view uri) -> result<texture_handle> {
+	null_texture_store::reservation reserved;
+	if(const auto err = textures_.reserve(uri).unwrap(reserved); err) [[unlikely]] {
+		return error("failed to load texture", *err);
+	}
+	if(!reserved.is_new) {
+		return reserved.key;
+	}
+
+	submit_load([this, handle = reserved.key, path = std::string(uri)]() -> async_loader::finish {
+		return [this, handle, path, size = null_texture::read_size(path)]() -> void {
+			if(!textures_.is_pending(handle)) {
+				return; // unloaded while it was read
+			}
+			glm::vec2 image_size{};
+			if(const auto err = size.unwrap(image_size); err) [[unlikely]] {
+				textures_.fail(handle, error("failed to load texture", *err));
+				log::error("failed to load texture `{}`: {}", path, err->to_string());
+				return;
+			}
+			if(const auto err = textures_.finish(handle, path, image_size).unwrap(); err) [[unlikely]] {
+				log::error("failed to load texture `{}`: {}", path, err->to_string());
+				return;
+			}
+			bump_texture_generation();
+		};
+	});
+	return reserved.key;
+}
+
+auto null_resource_manager::get_load_state(const texture_handle handle) const -> load_state {
+	return textures_.state(handle);
+}
+
+// =============================================================================
+// Sound
+// =============================================================================
+
+auto null_resource_manager::load_sound(const std::string_view uri) -> result<sound_handle> {
+	if(!exists(uri)) [[unlikely]] {
+		return error("sound file does not exist: " + std::string(uri));
+	}
+
+	sound_handle handle;
+	if(const auto err = sounds_.load(uri).unwrap(handle); err) [[unlikely]] {
+		return error("failed to load sound", *err);
+	}
+	return handle;
+}
+
+auto null_resource_manager::unload_sound(const sound_handle handle) -> result<> {
+	if(const auto err = sounds_.unload(handle).unwrap(); err) [[unlikely]] {
+		return error("failed to unload sound", *err);
+	}
+	return true;
+}
+
+auto null_resource_manager::has_sound(const sound_handle handle) const -> bool {
+	return sounds_.get(handle).has_value();
+}
+
+// =============================================================================
+// Music
+// =============================================================================
+
+auto null_resource_manager::load_music(const std::string_view uri) -> result<music_handle> {
+	if(!exists(uri)) [[unlikely]] {
+		return error("music file does not exist: " + std::string(uri));
+	}
+
+	music_handle handle;
+	if(const auto err = musics_.load(uri).unwrap(handle); err) [[unlikely]] {
+		return error("failed to load music", *err);
+	}
+	return handle;
+}
+
+auto null_resource_manager::unload_music(const music_handle handle) -> result<> {
+	if(const auto err = musics_.unload(handle).unwrap(); err) [[unlikely]] {
+		return error("failed to unload music", *err);
+	}
+	return true;
+}
+
+auto null_resource_manager::has_music(const music_handle handle) const -> bool {
+	return musics_.get(handle).has_value();
+}
+
+} // namespace lge
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/null/null_resources.hpp>
+#include <lge/internal/resource_manager/base_resource_manager.hpp>
+
+#include <glm/ext/vector_float2.hpp>
+#include <string_view>
+
+namespace lge {
+
+// loads real files, so sprite sheets and animations parse as usual, but keeps nothing for the GPU or audio device
+class null_resource_manager final: public base_resource_manager {
+public:
+	[[nodiscard]] auto init() -> result<> override;
+	[[nodiscard]] auto end() -> result<> override;
+
+	[[nodiscard]] auto load_font(std::string_view uri) -> result<font_handle> override;
+	[[nodiscard]] auto unload_font(font_handle handle) -> result<> override;
+
+	[[nodiscard]] auto load_texture(std::string_view uri) -> result<texture_handle> override;
+	[[nodiscard]] auto unload_texture(texture_handle handle) -> result<> override;
+	[[nodiscard]] auto get_texture_size(texture_handle handle) const -> result<glm::vec2>;
+
+	[[nodiscard]] auto load_texture_async(std::string_view uri) -> result<texture_handle> override;
+	[[nodiscard]] auto get_load_state(texture_handle handle) const -> load_state override;
+	using base_resource_manager::get_load_state;
+
+	// =============================================================================
+	// Sound
+	// =============================================================================
+
+	[[nodiscard]] auto load_sound(std::string_view uri) -> result<sound_handle> override;
+	[[nodiscard]] auto unload_sound(sound_handle handle) -> result<> override;
+	[[nodiscard]] auto has_sound(sound_handle handle) const -> bool;
+
+	// =============================================================================
+	// Music
+	// =============================================================================
+
+	[[nodiscard]] auto load_music(std::string_view uri) -> result<music_handle> override;
+	[[nodiscard]] auto unload_music(music_handle handle) -> result<> override;
+	[[nodiscard]] auto has_music(music_handle handle) const -> bool;
+
+private:
+	null_font_store fonts_;
+	null_texture_store textures_;
+	null_sound_store sounds_;
+	null_music_store musics_;
+};
+
+} // namespace lge
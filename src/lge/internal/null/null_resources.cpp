@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "null_resources.hpp"
+
+#include <lge/core/log.hpp>
+#include <lge/core/result.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <glm/ext/vector_float2.hpp>
+#include <string>
+#include <string_view>
+
+namespace lge {
+
+namespace {
+
+// PNG signature followed by the IHDR chunk, whose first fields are the big endian width and height
+constexpr std::array<std::uint8_t, 8> png_signature{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+constexpr std::size_t png_width_offset = 16;
+constexpr std::size_t png_header_size = 24;
+
+auto read_big_endian(const std::array<std::uint8_t, png_header_size> &bytes, const std::size_t offset)
+	-> std::uint32_t {
+	std::uint32_t value = 0;
+	for(std::size_t i = 0; i < 4; ++i) {
+		value = (value << 8U) | static_cast<std::uint32_t>(bytes.at(offset + i));
+	}
+	return value;
+}
+
+} // namespace
+
+auto null_asset::load(const std::string_view uri) -> result<> {
+	log::debug("null asset loaded from uri `{}`", uri);
+	return true;
+}
+
+auto null_texture::load(const std::string_view uri) -> result<> {
+	glm::vec2 image_size{};
+	if(const auto err = read_size(uri).unwrap(image_size); err) [[unlikely]] {
+		return *err;
+	}
+	return load(uri, image_size);
+}
+
+auto null_texture::load(const std::string_view uri, const glm::vec2 &image_size) -> result<> {
+	size = image_size;
+	log::debug("null texture loaded from uri `{}` with size ({}x{})", uri, size.x, size.y);
+	return true;
+}
+
+auto null_texture::read_size(const std::string_view uri) -> result<glm::vec2> {
+	std::ifstream file(std::string(uri), std::ios::binary);
+	if(!file) [[unlikely]] {
+		return error("failed to open texture from uri: " + std::string(uri));
+	}
+
+	std::array<std::uint8_t, png_header_size> header{};
+	file.read(reinterpret_cast<char *>(header.data()), header.size()); // NOLINT(*-reinterpret-cast)
+	if(file.gcount() != static_cast<std::streamsize>(header.size())) [[unlikely]] {
+		return error("texture file is too small: " + std::string(uri));
+	}
+
+	for(std::size_t i = 0; i < png_signature.size(); ++i) {
+		if(header.at(i) != png_signature.at(i)) [[unlikely]] {
+			// other formats load fine, they just report no size
+			log::warn("texture `{}` is not a png, its size is unknown", uri);
+			return glm::vec2{};
+		}
+	}
+
+	return glm::vec2{static_cast<float>(read_big_endian(header, png_width_offset)),
+					 static_cast<float>(read_big_endian(header, png_width_offset + 4))};
+}
+
+} // namespace lge
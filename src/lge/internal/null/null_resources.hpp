@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/resource_manager/resource_store.hpp>
+
+#include <glm/ext/vector_float2.hpp>
+#include <string_view>
+
+namespace lge {
+
+// a font, sound or music that only records that its file exists
+class null_asset {
+public:
+	[[nodiscard]] auto load(std::string_view uri) -> result<>;
+};
+
+// a texture that keeps the image size, read from the file header, but no pixels
+class null_texture {
+public:
+	[[nodiscard]] auto load(std::string_view uri) -> result<>;
+	// with the size read beforehand
+	[[nodiscard]] auto load(std::string_view uri, const glm::vec2 &image_size) -> result<>;
+
+	// reads only the file, so it may run on a loader thread; zero when the size is unknown
+	[[nodiscard]] static auto read_size(std::string_view uri) -> result<glm::vec2>;
+
+	glm::vec2 size{};
+};
+
+using null_font_store = resource_store<null_asset, font_handle>;
+using null_texture_store = resource_store<null_texture, texture_handle>;
+using null_sound_store = resource_store<null_asset, sound_handle>;
+using null_music_store = resource_store<null_asset, music_handle>;
+
+} // namespace lge
@@ -7,29 +7,120 @@
 #include <lge/core/colors.hpp>
 #include <lge/core/log.hpp>
 #include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
 #include <lge/interface/renderer.hpp>
 #include <lge/interface/resources.hpp>
 #include <lge/internal/text/rich_text.hpp>
+#include <lge/text/glyph_layout.hpp>
 #include <lge/text/text_segment.hpp>
 
 #include "raylib_resource_manager.hpp"
 
 #include <raylib.h>
 
+#include <algorithm>
 #include <cstdarg>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <entt/core/fwd.hpp>
 #include <format>
+#include <glm/ext/vector_float2.hpp>
 #include <glm/trigonometric.hpp>
 #include <rlgl.h>
 #include <span>
 #include <spdlog/common.h>
 #include <spdlog/spdlog.h>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace lge {
 
+namespace {
+
+// the pen walk of DrawTextEx over a run of text, calling glyph(codepoint, index, pen) for every visible glyph;
+// the pen is carried across calls so a label can be walked one segment at a time
+template<typename Glyph>
+auto walk_glyphs(const Font &font,
+				 const std::string_view text,
+				 const float size,
+				 const float line_spacing,
+				 glm::vec2 &pen,
+				 Glyph &&glyph) -> void {
+	const auto scale = size / static_cast<float>(font.baseSize);
+	const auto *current = text.data();
+	const auto *const end = current + text.size();
+
+	while(current < end) {
+		auto bytes = 0;
+		const auto codepoint = GetCodepointNext(current, &bytes);
+		current += bytes;
+
+		if(codepoint == '\n') {
+			pen.x = 0.0F;
+			pen.y += size + line_spacing;
+			continue;
+		}
+
+		const auto index = GetGlyphIndex(font, codepoint);
+		if(codepoint != ' ' && codepoint != '\t') {
+			glyph(codepoint, index, pen);
+		}
+
+		const auto advance = font.glyphs[index].advanceX == 0 ? font.recs[index].width
+															  : static_cast<float>(font.glyphs[index].advanceX);
+		pen.x += (advance * scale) + scale;
+	}
+}
+
+// MeasureTextEx over the runs between rich tags, so tagged text is measured without a stripped copy
+auto measure_runs(const Font &font, const std::string_view text, const float size, const float line_spacing)
+	-> glm::vec2 {
+	auto width = 0.0F;
+	auto widest = 0.0F;
+	auto height = size;
+	std::size_t glyphs = 0;
+	std::size_t most_glyphs = 0;
+	auto empty = true;
+
+	for_each_plain_run(text, [&](const std::string_view run) -> void {
+		empty = false;
+		const auto *current = run.data();
+		const auto *const end = current + run.size();
+		while(current < end) {
+			auto bytes = 0;
+			const auto codepoint = GetCodepointNext(current, &bytes);
+			current += bytes;
+			++glyphs;
+
+			if(codepoint != '\n') {
+				const auto index = GetGlyphIndex(font, codepoint);
+				const auto &info = font.glyphs[index];
+				width += info.advanceX > 0 ? static_cast<float>(info.advanceX)
+										   : font.recs[index].width + static_cast<float>(info.offsetX);
+			} else {
+				widest = std::max(widest, width);
+				glyphs = 0;
+				width = 0.0F;
+				height += size + line_spacing;
+			}
+			most_glyphs = std::max(most_glyphs, glyphs);
+		}
+	});
+
+	if(empty || font.texture.id == 0) [[unlikely]] {
+		return {0.0F, 0.0F};
+	}
+
+	const auto scale = size / static_cast<float>(font.baseSize);
+	widest = std::max(widest, width);
+	return {(widest * scale) + ((static_cast<float>(most_glyphs) - 1.0F) * scale), height};
+}
+
+} // namespace
+
 auto raylib_renderer::init(const app_config &config) -> result<> {
 	clear_color_ = color_to_raylib(config.clear_color);
 	design_resolution_ = config.design_resolution;
@@ -37,6 +128,10 @@ auto raylib_renderer::init(const app_config &config) -> result<> {
 
 	setup_raylib_log();
 
+	if(config.vsync) {
+		SetConfigFlags(FLAG_VSYNC_HINT);
+	}
+
 #if defined(_WIN32) || defined(__EMSCRIPTEN__)
 	// we need to create a window before we can get the monitor size
 	InitWindow(1920, 1080, title_.c_str());
@@ -75,7 +170,7 @@ auto raylib_renderer::init(const app_config &config) -> result<> {
 #endif
 
 	SetExitKey(KEY_NULL);
-	SetTargetFPS(60);
+	SetTargetFPS(config.target_fps); // 0 or less does not cap
 #ifndef __EMSCRIPTEN__
 	const auto &icon_path = config.window_icon_path.empty() ? std::string_view{default_icon_path}
 															: std::string_view{config.window_icon_path};
@@ -111,8 +206,14 @@ auto raylib_renderer::end() -> result<> {
 		}
 	}
 
+	for(const auto &[cache, target]: caches_) {
+		UnloadRenderTexture(target);
+	}
+	caches_.clear();
+
 	CloseWindow();
 	initialized_ = false;
+	label_sizes_.clear();
 
 	if(render_texture_.id != 0) [[unlikely]] {
 		UnloadRenderTexture(render_texture_);
@@ -230,11 +331,51 @@ auto raylib_renderer::get_drawing_resolution() const -> glm::vec2 {
 }
 
 auto raylib_renderer::get_label_size(const font_handle font, const std::string &text, const int &size) -> glm::vec2 {
+	if(const auto *cached = label_sizes_.find(font, size, text); cached != nullptr) [[likely]] {
+		return *cached;
+	}
+
+	const auto measured = measure_runs(resolve_font(font), text, static_cast<float>(size), text_line_spacing);
+	label_sizes_.insert(font, size, text, measured);
+	return measured;
+}
+
+// the same walk DrawTextEx does, kept as quads so drawing the label does not decode or look up any glyph
+auto raylib_renderer::layout_label(const font_handle font,
+								   const std::string &text,
+								   const int &size,
+								   const color &text_color) -> glyph_layout {
 	const auto rl_font = resolve_font(font);
-	const auto spacing = static_cast<float>(size) / static_cast<float>(rl_font.baseSize);
-	const auto plain = has_rich_tags(text) ? strip_rich_tags(text) : text;
-	const auto [width, height] = MeasureTextEx(rl_font, plain.c_str(), static_cast<float>(size), spacing);
-	return {width, height};
+	const auto fsize = static_cast<float>(size);
+	const auto scale = fsize / static_cast<float>(rl_font.baseSize);
+	const auto padding = static_cast<float>(rl_font.glyphPadding);
+
+	glyph_layout layout{.font = font, .size = fsize, .glyphs = {}};
+	glm::vec2 pen{0.0F, 0.0F};
+
+	parse_rich_text(text, text_color, segments_);
+	for(const auto &seg: segments_) {
+		walk_glyphs(rl_font,
+					seg.view(text),
+					fsize,
+					text_line_spacing,
+					pen,
+					[&](int /*codepoint*/, const int index, const glm::vec2 &at) -> void {
+						const auto &rec = rl_font.recs[index];
+						const auto &info = rl_font.glyphs[index];
+						const glm::vec2 source_size{rec.width + (2.0F * padding), rec.height + (2.0F * padding)};
+						layout.glyphs.push_back({
+							.source_pos = {rec.x - padding, rec.y - padding},
+							.source_size = source_size,
+							.offset = {at.x + ((static_cast<float>(info.offsetX) - padding) * scale),
+									   at.y + ((static_cast<float>(info.offsetY) - padding) * scale)},
+							.size = source_size * scale,
+							.tint = seg.segment_color,
+						});
+					});
+	}
+
+	return layout;
 }
 
 auto raylib_renderer::show_cursor(const bool show) -> void {
@@ -356,6 +497,31 @@ auto raylib_renderer::get_texture_size(const texture_handle texture) -> glm::vec
 	return {static_cast<float>(rl_texture.width), static_cast<float>(rl_texture.height)};
 }
 
+auto raylib_renderer::resolve_sprite_frame(const sprite_sheet_handle sheet, const entt::id_type frame) const
+	-> result<resolved_frame> {
+	sprite_sheet_frame f{};
+	if(const auto err = resource_manager_.get_sprite_sheet_frame(sheet, frame).unwrap(f); err) [[unlikely]] {
+		return error("failed to resolve sprite frame", *err);
+	}
+
+	texture_handle tex_handle{};
+	if(const auto err = resource_manager_.get_sprite_sheet_texture(sheet).unwrap(tex_handle); err) [[unlikely]] {
+		return error("failed to resolve sprite sheet texture", *err);
+	}
+
+	Texture2D rl_texture{};
+	if(const auto err = resource_manager_.get_raylib_texture(tex_handle).unwrap(rl_texture); err) [[unlikely]] {
+		return error("failed to resolve raylib texture", *err);
+	}
+
+	return resolved_frame{
+		.texture_id = rl_texture.id,
+		.texture_size = {static_cast<float>(rl_texture.width), static_cast<float>(rl_texture.height)},
+		.source_pos = f.source_pos,
+		.source_size = f.source_size,
+	};
+}
+
 auto raylib_renderer::get_sprite_frame_size(const sprite_sheet_handle sheet, const entt::id_type frame) -> glm::vec2 {
 	sprite_sheet_frame f{};
 	if(const auto err = resource_manager_.get_sprite_sheet_frame(sheet, frame).unwrap(f); err) [[unlikely]] {
@@ -424,11 +590,253 @@ auto raylib_renderer::render_panel(const sprite_sheet_handle sheet,
 		return;
 	}
 
-	const auto screen_pos = to_screen(pivot_position);
+	draw_npatch(rl_texture,
+				f.source_pos,
+				f.source_size,
+				panel_draw{
+					.sheet = sheet,
+					.frame = frame,
+					.pivot_position = pivot_position,
+					.size = size,
+					.pivot = pivot,
+					.rotation = rotation,
+					.border = border,
+					.tint = tint,
+					.source = {},
+				});
+}
+
+auto raylib_renderer::submit(const draw_list &list) const -> void {
+	const auto commands = list.commands();
+	for(std::size_t i = 0; i < commands.size();) {
+		const auto &cmd = commands[i];
+
+		if(cmd.kind == draw_kind::sprite) {
+			auto end = i + 1;
+			while(end < commands.size() && commands[end].kind == draw_kind::sprite) {
+				++end;
+			}
+			render_sprite_run(list, commands.subspan(i, end - i));
+			i = end;
+			continue;
+		}
+
+		switch(cmd.kind) {
+		case draw_kind::panel:
+			render_resolved_panel(list.panels()[cmd.payload]);
+			break;
+		case draw_kind::label: {
+			const auto &d = list.labels()[cmd.payload];
+			render_label(d.font, *d.text, d.size, d.text_color, d.pivot_position, d.rotated_offset, d.rotation);
+			break;
+		}
+		case draw_kind::rich_label: {
+			const auto &d = list.rich_labels()[cmd.payload];
+			render_rich_label(d.font, *d.text, d.segments, d.size, d.pivot_position, d.rotated_offset, d.rotation);
+			break;
+		}
+		case draw_kind::glyphs: {
+			const auto &d = list.glyphs()[cmd.payload];
+			render_glyphs(*d.layout, d.scale, d.pivot_position, d.rotated_offset, d.rotation);
+			break;
+		}
+		case draw_kind::rect: {
+			const auto &d = list.rects()[cmd.payload];
+			render_rect(d.center, d.size, d.rotation, d.border_color, d.fill_color, d.border_thickness);
+			break;
+		}
+		case draw_kind::circle: {
+			const auto &d = list.circles()[cmd.payload];
+			render_circle(d.center, d.radius, d.border_color, d.fill_color, d.border_thickness);
+			break;
+		}
+		case draw_kind::quad: {
+			const auto &d = list.quads()[cmd.payload];
+			render_quad(d.p0, d.p1, d.p2, d.p3, d.quad_color);
+			break;
+		}
+		case draw_kind::cache:
+			render_cached(list.caches()[cmd.payload]);
+			break;
+		case draw_kind::sprite:
+			break;
+		}
+		++i;
+	}
+}
+
+auto raylib_renderer::render_to_cache(const std::uint32_t cache,
+									  const glm::vec2 &origin,
+									  const glm::vec2 &size,
+									  const draw_list &list) -> void {
+	// raylib does not nest texture modes, the frame's texture is left and entered again around the cache
+	EndTextureMode();
+
+	const auto width = static_cast<int>(size.x);
+	const auto height = static_cast<int>(size.y);
+	auto &target = caches_[cache];
+	if(target.texture.width != width || target.texture.height != height) {
+		if(target.id != 0) {
+			UnloadRenderTexture(target);
+		}
+		target = LoadRenderTexture(width, height);
+	}
+
+	BeginTextureMode(target);
+	ClearBackground(BLANK);
+
+	// colors are stored premultiplied, with alpha added rather than multiplied, so the texture blends like the
+	// draws it replaces once render_cached draws it with premultiplied blending
+	rlSetBlendFactorsSeparate(
+		RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+	BeginBlendMode(BLEND_CUSTOM_SEPARATE);
 
-	const auto border_i = static_cast<int>(border);
+	const auto top_left = to_screen(origin);
+	rlPushMatrix();
+	rlTranslatef(-top_left.x, -top_left.y, 0.0F);
+	submit(list);
+	rlPopMatrix();
+
+	EndBlendMode();
+	EndTextureMode();
+
+	BeginTextureMode(render_texture_);
+}
+
+auto raylib_renderer::release_cache(const std::uint32_t cache) -> void {
+	if(const auto it = caches_.find(cache); it != caches_.end()) {
+		UnloadRenderTexture(it->second);
+		caches_.erase(it);
+	}
+}
+
+auto raylib_renderer::render_cached(const cache_draw &draw) const -> void {
+	const auto it = caches_.find(draw.cache);
+	if(it == caches_.end()) [[unlikely]] {
+		return;
+	}
+
+	const auto &texture = it->second.texture;
+	const auto top_left = to_screen(draw.origin);
+
+	// render textures are stored upside down
+	BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+	DrawTexturePro(texture,
+				   {.x = 0.0F,
+					.y = 0.0F,
+					.width = static_cast<float>(texture.width),
+					.height = -static_cast<float>(texture.height)},
+				   {.x = top_left.x, .y = top_left.y, .width = draw.size.x, .height = draw.size.y},
+				   {.x = 0.0F, .y = 0.0F},
+				   0.0F,
+				   WHITE);
+	EndBlendMode();
+}
+
+// sprites arrive grouped by texture, so each run of the same texture is a single bind and batch of quads
+auto raylib_renderer::render_sprite_run(const draw_list &list, const std::span<const draw_command> run) const -> void {
+	std::uint32_t bound_texture = 0;
+
+	for(const auto &cmd: run) {
+		const auto &draw = list.sprites()[cmd.payload];
+
+		// sprites without a cached frame, like button overlays, are resolved here
+		auto frame = draw.source;
+		if(frame.texture_id == 0) [[unlikely]] {
+			if(const auto err = resolve_sprite_frame(draw.sheet, draw.frame).unwrap(frame); err) [[unlikely]] {
+				continue;
+			}
+		}
+
+		if(frame.texture_id != bound_texture) {
+			if(bound_texture != 0) {
+				rlEnd();
+				rlSetTexture(0);
+			}
+			bound_texture = frame.texture_id;
+			rlSetTexture(bound_texture);
+			rlBegin(RL_QUADS);
+		}
+
+		// flushes the batch when full and keeps the current texture bound
+		rlCheckRenderBatchLimit(4);
+		emit_sprite_quad(frame, draw);
+	}
+
+	if(bound_texture != 0) {
+		rlEnd();
+		rlSetTexture(0);
+	}
+}
+
+// same geometry as DrawTexturePro, without binding the texture for every quad
+auto raylib_renderer::emit_sprite_quad(const resolved_frame &frame, const sprite_draw &draw) const -> void {
+	const auto screen_pos = to_screen(draw.pivot_position);
+	const auto origin = draw.pivot * draw.size;
+
+	const auto rad = glm::radians(draw.rotation);
+	const auto cos_r = glm::cos(rad);
+	const auto sin_r = glm::sin(rad);
+	const auto corner = [&](const float x, const float y) -> glm::vec2 {
+		const auto dx = x - origin.x;
+		const auto dy = y - origin.y;
+		return {screen_pos.x + (dx * cos_r) - (dy * sin_r), screen_pos.y + (dx * sin_r) + (dy * cos_r)};
+	};
+	const auto top_left = corner(0.0F, 0.0F);
+	const auto top_right = corner(draw.size.x, 0.0F);
+	const auto bottom_left = corner(0.0F, draw.size.y);
+	const auto bottom_right = corner(draw.size.x, draw.size.y);
+
+	auto u0 = frame.source_pos.x / frame.texture_size.x;
+	auto u1 = (frame.source_pos.x + frame.source_size.x) / frame.texture_size.x;
+	auto v0 = frame.source_pos.y / frame.texture_size.y;
+	auto v1 = (frame.source_pos.y + frame.source_size.y) / frame.texture_size.y;
+	if(draw.flip_horizontal) {
+		std::swap(u0, u1);
+	}
+	if(draw.flip_vertical) {
+		std::swap(v0, v1);
+	}
+
+	rlColor4ub(draw.tint.r, draw.tint.g, draw.tint.b, draw.tint.a);
+	rlNormal3f(0.0F, 0.0F, 1.0F);
+	rlTexCoord2f(u0, v0);
+	rlVertex2f(top_left.x, top_left.y);
+	rlTexCoord2f(u0, v1);
+	rlVertex2f(bottom_left.x, bottom_left.y);
+	rlTexCoord2f(u1, v1);
+	rlVertex2f(bottom_right.x, bottom_right.y);
+	rlTexCoord2f(u1, v0);
+	rlVertex2f(top_right.x, top_right.y);
+}
+
+auto raylib_renderer::render_resolved_panel(const panel_draw &draw) const -> void {
+	if(draw.source.texture_id == 0) [[unlikely]] {
+		render_panel(
+			draw.sheet, draw.frame, draw.pivot_position, draw.size, draw.pivot, draw.rotation, draw.border, draw.tint);
+		return;
+	}
+
+	// DrawTextureNPatch only reads the id and size of the texture
+	const auto rl_texture = Texture2D{
+		.id = draw.source.texture_id,
+		.width = static_cast<int>(draw.source.texture_size.x),
+		.height = static_cast<int>(draw.source.texture_size.y),
+		.mipmaps = 1,
+		.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+	};
+	draw_npatch(rl_texture, draw.source.source_pos, draw.source.source_size, draw);
+}
+
+auto raylib_renderer::draw_npatch(const Texture2D &rl_texture,
+								  const glm::vec2 &source_pos,
+								  const glm::vec2 &source_size,
+								  const panel_draw &draw) const -> void {
+	const auto screen_pos = to_screen(draw.pivot_position);
+
+	const auto border_i = static_cast<int>(draw.border);
 	const NPatchInfo npatch{
-		.source = {.x = f.source_pos.x, .y = f.source_pos.y, .width = f.source_size.x, .height = f.source_size.y},
+		.source = {.x = source_pos.x, .y = source_pos.y, .width = source_size.x, .height = source_size.y},
 		.left = border_i,
 		.top = border_i,
 		.right = border_i,
@@ -436,10 +844,10 @@ auto raylib_renderer::render_panel(const sprite_sheet_handle sheet,
 		.layout = NPATCH_NINE_PATCH,
 	};
 
-	const auto dest = Rectangle{.x = screen_pos.x, .y = screen_pos.y, .width = size.x, .height = size.y};
-	const auto origin = Vector2{.x = pivot.x * size.x, .y = pivot.y * size.y};
+	const auto dest = Rectangle{.x = screen_pos.x, .y = screen_pos.y, .width = draw.size.x, .height = draw.size.y};
+	const auto origin = Vector2{.x = draw.pivot.x * draw.size.x, .y = draw.pivot.y * draw.size.y};
 
-	DrawTextureNPatch(rl_texture, npatch, dest, origin, rotation, color_to_raylib(tint));
+	DrawTextureNPatch(rl_texture, npatch, dest, origin, draw.rotation, color_to_raylib(draw.tint));
 }
 
 auto raylib_renderer::render_label(const font_handle font,
@@ -463,6 +871,7 @@ auto raylib_renderer::render_label(const font_handle font,
 }
 
 auto raylib_renderer::render_rich_label(const font_handle font,
+										const std::string &text,
 										const std::span<const text_segment> segments,
 										const int &size,
 										const glm::vec2 &pivot_position,
@@ -474,7 +883,6 @@ auto raylib_renderer::render_rich_label(const font_handle font,
 
 	const auto rl_font = resolve_font(font);
 	const auto fsize = static_cast<float>(size);
-	const auto line_height = fsize;
 	const auto screen_pivot = to_screen(pivot_position);
 
 	rlPushMatrix();
@@ -482,36 +890,66 @@ auto raylib_renderer::render_rich_label(const font_handle font,
 	rlRotatef(rotation, 0.0F, 0.0F, 1.0F);
 	rlTranslatef(pivot_to_top_left.x, pivot_to_top_left.y, 0.0F);
 
-	float cursor_x = 0.0F;
-	float cursor_y = 0.0F;
-
+	// glyph by glyph straight from the segments, no line is copied to hand it to DrawTextEx
+	glm::vec2 pen{0.0F, 0.0F};
 	for(const auto &seg: segments) {
-		if(seg.text.empty()) [[unlikely]] {
-			continue;
-		}
-
-		const std::string_view sv{seg.text};
-		std::size_t line_start = 0;
+		const auto tint = color_to_raylib(seg.segment_color);
+		walk_glyphs(rl_font,
+					seg.view(text),
+					fsize,
+					text_line_spacing,
+					pen,
+					[&](const int codepoint, int /*index*/, const glm::vec2 &at) -> void {
+						DrawTextCodepoint(rl_font, codepoint, {.x = at.x, .y = at.y}, fsize, tint);
+					});
+	}
 
-		while(line_start <= sv.size()) {
-			const auto newline_pos = sv.find('\n', line_start);
-			const auto end = (newline_pos == std::string_view::npos) ? sv.size() : newline_pos;
-			const auto line = std::string{sv.substr(line_start, end - line_start)};
+	rlPopMatrix();
+}
 
-			if(!line.empty()) {
-				render_text_line(rl_font, line, fsize, color_to_raylib(seg.segment_color), {cursor_x, cursor_y});
-				cursor_x += MeasureTextEx(rl_font, line.c_str(), fsize, fsize / static_cast<float>(rl_font.baseSize)).x;
-			}
+auto raylib_renderer::render_glyphs(const glyph_layout &layout,
+									const float scale,
+									const glm::vec2 &pivot_position,
+									const glm::vec2 &pivot_to_top_left,
+									const float rotation) const -> void {
+	if(layout.glyphs.empty()) [[unlikely]] {
+		return;
+	}
 
-			if(newline_pos == std::string_view::npos) {
-				break;
-			}
+	const auto rl_font = resolve_font(layout.font);
+	const glm::vec2 texture_size{static_cast<float>(rl_font.texture.width), static_cast<float>(rl_font.texture.height)};
+	const auto screen_pivot = to_screen(pivot_position);
 
-			cursor_x = 0.0F;
-			cursor_y += line_height;
-			line_start = newline_pos + 1;
-		}
+	rlPushMatrix();
+	rlTranslatef(screen_pivot.x, screen_pivot.y, 0.0F);
+	rlRotatef(rotation, 0.0F, 0.0F, 1.0F);
+	rlTranslatef(pivot_to_top_left.x, pivot_to_top_left.y, 0.0F);
+	rlScalef(scale, scale, 1.0F);
+
+	rlSetTexture(rl_font.texture.id);
+	rlBegin(RL_QUADS);
+	for(const auto &glyph: layout.glyphs) {
+		// flushes the batch when full and keeps the font texture bound
+		rlCheckRenderBatchLimit(4);
+
+		const auto uv0 = glyph.source_pos / texture_size;
+		const auto uv1 = (glyph.source_pos + glyph.source_size) / texture_size;
+		const auto p0 = glyph.offset;
+		const auto p1 = glyph.offset + glyph.size;
+
+		rlColor4ub(glyph.tint.r, glyph.tint.g, glyph.tint.b, glyph.tint.a);
+		rlNormal3f(0.0F, 0.0F, 1.0F);
+		rlTexCoord2f(uv0.x, uv0.y);
+		rlVertex2f(p0.x, p0.y);
+		rlTexCoord2f(uv0.x, uv1.y);
+		rlVertex2f(p0.x, p1.y);
+		rlTexCoord2f(uv1.x, uv1.y);
+		rlVertex2f(p1.x, p1.y);
+		rlTexCoord2f(uv1.x, uv0.y);
+		rlVertex2f(p1.x, p0.y);
 	}
+	rlEnd();
+	rlSetTexture(0);
 
 	rlPopMatrix();
 }
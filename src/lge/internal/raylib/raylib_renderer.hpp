@@ -6,19 +6,25 @@
 #include <lge/app/app_config.hpp>
 #include <lge/core/colors.hpp>
 #include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
 #include <lge/interface/renderer.hpp>
 #include <lge/interface/resource_manager.hpp>
 #include <lge/internal/raylib/raylib_resource_manager.hpp>
 #include <lge/internal/text/rich_text.hpp>
+#include <lge/internal/text/text_metrics_cache.hpp>
+#include <lge/text/glyph_layout.hpp>
 
 #include <raylib.h>
 
 #include <entt/core/fwd.hpp>
+#include <cstdint>
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float4.hpp>
 #include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace lge {
 
@@ -45,8 +51,12 @@ public:
 	auto toggle_fullscreen() -> void override;
 
 	auto get_label_size(font_handle font, const std::string &text, const int &size) -> glm::vec2 override;
+	[[nodiscard]] auto layout_label(font_handle font, const std::string &text, const int &size, const color &text_color)
+		-> glyph_layout override;
 	auto get_texture_size(texture_handle texture) -> glm::vec2 override;
 	auto get_sprite_frame_size(sprite_sheet_handle sheet, entt::id_type frame) -> glm::vec2 override;
+	[[nodiscard]] auto resolve_sprite_frame(sprite_sheet_handle sheet, entt::id_type frame) const
+		-> result<resolved_frame> override;
 
 	auto show_cursor(bool show) -> void override;
 
@@ -63,12 +73,19 @@ public:
 					  float rotation) const -> void override;
 
 	auto render_rich_label(font_handle font,
+						   const std::string &text,
 						   std::span<const text_segment> segments,
 						   const int &size,
 						   const glm::vec2 &pivot_position,
 						   const glm::vec2 &rotated_offset,
 						   float rotation) const -> void override;
 
+	auto render_glyphs(const glyph_layout &layout,
+					   float scale,
+					   const glm::vec2 &pivot_position,
+					   const glm::vec2 &rotated_offset,
+					   float rotation) const -> void override;
+
 	auto render_sprite(sprite_sheet_handle sheet,
 					   entt::id_type frame,
 					   const glm::vec2 &pivot_position,
@@ -88,6 +105,12 @@ public:
 					  float border,
 					  color tint) const -> void override;
 
+	auto submit(const draw_list &list) const -> void override;
+
+	auto render_to_cache(std::uint32_t cache, const glm::vec2 &origin, const glm::vec2 &size, const draw_list &list)
+		-> void override;
+	auto release_cache(std::uint32_t cache) -> void override;
+
 	auto render_quad(const glm::vec2 &p0,
 					 const glm::vec2 &p1,
 					 const glm::vec2 &p2,
@@ -127,6 +150,9 @@ private:
 	glm::vec2 drawing_resolution_{};
 	float scale_factor_{1.0F};
 	RenderTexture2D render_texture_{};
+	text_metrics_cache label_sizes_;
+	std::vector<text_segment> segments_; // scratch for laying out labels
+	std::unordered_map<std::uint32_t, RenderTexture2D> caches_;
 
 	[[nodiscard]] auto screen_size_changed(glm::vec2 screen_size) -> result<>;
 
@@ -140,6 +166,15 @@ private:
 
 	[[nodiscard]] auto resolve_font(font_handle font) const -> Font;
 
+	auto render_sprite_run(const draw_list &list, std::span<const draw_command> run) const -> void;
+	auto emit_sprite_quad(const resolved_frame &frame, const sprite_draw &draw) const -> void;
+	auto render_resolved_panel(const panel_draw &draw) const -> void;
+	auto render_cached(const cache_draw &draw) const -> void;
+	auto draw_npatch(const Texture2D &rl_texture,
+					 const glm::vec2 &source_pos,
+					 const glm::vec2 &source_size,
+					 const panel_draw &draw) const -> void;
+
 	static auto render_text_line(const Font &rl_font,
 								 const std::string &text,
 								 float size,
@@ -147,6 +182,8 @@ private:
 								 const glm::vec2 &position) -> void;
 
 	font_handle default_font_{};
+	// raylib's default gap between text lines, added to the font size by DrawTextEx and MeasureTextEx
+	static constexpr auto text_line_spacing = 2.0F;
 	static constexpr auto default_font_path = "resources/lge/font/peaberry_pixel_outline_16.fnt";
 	static constexpr auto default_icon_path = "resources/lge/icon/lge.png";
 };
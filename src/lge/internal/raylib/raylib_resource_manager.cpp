@@ -10,12 +10,15 @@
 #include <lge/internal/raylib/raylib_music.hpp>
 #include <lge/internal/raylib/raylib_sound.hpp>
 #include <lge/internal/raylib/raylib_texture.hpp>
+#include <lge/internal/resource_manager/async_loader.hpp>
 
 #include <raylib.h>
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace lge {
 
@@ -30,6 +33,7 @@ auto raylib_resource_manager::init() -> result<> {
 
 auto raylib_resource_manager::end() -> result<> {
 	log::debug("ending raylib resource manager");
+	stop_loads();
 	return true;
 }
 
@@ -81,6 +85,8 @@ auto raylib_resource_manager::load_texture(const std::string_view uri) -> result
 	if(const auto err = textures_.load(uri).unwrap(handle); err) [[unlikely]] {
 		return error("failed to load texture", *err);
 	}
+	// it may have been pending, resolved as missing until now
+	bump_texture_generation();
 	return handle;
 }
 
@@ -88,6 +94,7 @@ auto raylib_resource_manager::unload_texture(const texture_handle handle) -> res
 	if(const auto err = textures_.unload(handle).unwrap(); err) [[unlikely]] {
 		return error("failed to unload texture", *err);
 	}
+	bump_texture_generation();
 	return true;
 }
 
@@ -99,6 +106,44 @@ auto raylib_resource_manager::get_raylib_texture(const texture_handle handle) co
 	return data->raylib_native_texture;
 }
 
+auto raylib_resource_manager::load_texture_async(const std::string_view uri) -> result<texture_handle> {
+	log::debug("loading texture asynchronously from uri `{}`", uri);
+
+	texture_store::reservation reserved;
+	if(const auto err = textures_.reserve(uri).unwrap(reserved); err) [[unlikely]] {
+		return error("failed to load texture", *err);
+	}
+	if(!reserved.is_new) {
+		return reserved.key;
+	}
+
+	// the file is read and decoded on a loader thread, only the upload waits for the main thread
+	submit_load([this, handle = reserved.key, path = std::string(uri)]() -> async_loader::finish {
+		auto image = std::make_shared<raylib_image>();
+		auto decoded = image->load(path);
+		return [this, handle, path, image, decoded]() -> void {
+			if(!textures_.is_pending(handle)) {
+				return; // unloaded while it was decoded
+			}
+			if(const auto err = decoded.unwrap(); err) [[unlikely]] {
+				textures_.fail(handle, error("failed to load texture", *err));
+				log::error("failed to load texture `{}`: {}", path, err->to_string());
+				return;
+			}
+			if(const auto err = textures_.finish(handle, path, std::as_const(*image)).unwrap(); err) [[unlikely]] {
+				log::error("failed to load texture `{}`: {}", path, err->to_string());
+				return;
+			}
+			bump_texture_generation();
+		};
+	});
+	return reserved.key;
+}
+
+auto raylib_resource_manager::get_load_state(const texture_handle handle) const -> load_state {
+	return textures_.state(handle);
+}
+
 // =============================================================================
 // Sound
 // =============================================================================
@@ -31,6 +31,10 @@ public:
 	[[nodiscard]] auto unload_texture(texture_handle handle) -> result<> override;
 	[[nodiscard]] auto get_raylib_texture(texture_handle handle) const -> result<Texture2D>;
 
+	[[nodiscard]] auto load_texture_async(std::string_view uri) -> result<texture_handle> override;
+	[[nodiscard]] auto get_load_state(texture_handle handle) const -> load_state override;
+	using base_resource_manager::get_load_state;
+
 	// =============================================================================
 	// Sound
 	// =============================================================================
@@ -12,6 +12,20 @@
 
 namespace lge {
 
+raylib_image::~raylib_image() {
+	if(raylib_native_image.data != nullptr) {
+		UnloadImage(raylib_native_image);
+	}
+}
+
+auto raylib_image::load(const std::string_view uri) -> result<> {
+	raylib_native_image = LoadImage(std::string(uri).c_str());
+	if(raylib_native_image.data == nullptr) [[unlikely]] {
+		return error("failed to load image from uri: " + std::string(uri));
+	}
+	return true;
+}
+
 raylib_texture::~raylib_texture() {
 	if(raylib_native_texture.id != 0) {
 		UnloadTexture(raylib_native_texture);
@@ -28,4 +42,14 @@ auto raylib_texture::load(const std::string_view uri) -> result<> {
 	return true;
 }
 
+auto raylib_texture::load(const std::string_view uri, const raylib_image &image) -> result<> {
+	raylib_native_texture = LoadTextureFromImage(image.raylib_native_image);
+	if(raylib_native_texture.id == 0) [[unlikely]] {
+		return error("failed to upload texture from uri: " + std::string(uri));
+	}
+	SetTextureFilter(raylib_native_texture, TEXTURE_FILTER_POINT);
+	log::debug("uploaded texture from uri `{}` with texture id {}", uri, raylib_native_texture.id);
+	return true;
+}
+
 } // namespace lge
\ No newline at end of file
@@ -13,6 +13,21 @@
 
 namespace lge {
 
+// pixels decoded in memory, which needs no GPU so any thread may do it, waiting to be uploaded as a texture
+class raylib_image {
+public:
+	raylib_image() = default;
+	~raylib_image();
+	raylib_image(const raylib_image &) = delete;
+	auto operator=(const raylib_image &) -> raylib_image & = delete;
+	raylib_image(raylib_image &&) = delete;
+	auto operator=(raylib_image &&) -> raylib_image & = delete;
+
+	[[nodiscard]] auto load(std::string_view uri) -> result<>;
+
+	Image raylib_native_image{};
+};
+
 class raylib_texture {
 public:
 	raylib_texture() = default;
@@ -23,6 +38,8 @@ public:
 	auto operator=(raylib_texture &&) noexcept -> raylib_texture & = default;
 
 	[[nodiscard]] auto load(std::string_view uri) -> result<>;
+	// uploads an image decoded beforehand, on the main thread
+	[[nodiscard]] auto load(std::string_view uri, const raylib_image &image) -> result<>;
 
 	Texture2D raylib_native_texture{};
 };
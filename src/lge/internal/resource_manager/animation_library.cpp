@@ -35,29 +35,54 @@ auto animation_library::load(const std::string_view uri, resource_manager &rm) -
 	log::debug("loading animation library from uri `{}`", uri);
 	rm_ = &rm;
 
+	animation_library_source source;
+	if(const auto err = read(uri).unwrap(source); err) [[unlikely]] {
+		return *err;
+	}
+
+	if(const auto err = rm.load_sprite_sheet(source.sprite_sheet_path).unwrap(sprite_sheet); err) [[unlikely]] {
+		return error("failed to load animation library sprite sheet", *err);
+	}
+
+	animations = std::move(source.animations);
+	return true;
+}
+
+auto animation_library::load(const std::string_view uri, resource_manager &rm, animation_library_source &&source)
+	-> result<> {
+	log::debug("finishing animation library from uri `{}`", uri);
+	rm_ = &rm;
+
+	if(const auto err = rm.load_sprite_sheet_async(source.sprite_sheet_path).unwrap(sprite_sheet); err) [[unlikely]] {
+		return error("failed to load animation library sprite sheet for: " + std::string(uri), *err);
+	}
+
+	animations = std::move(source.animations);
+	return true;
+}
+
+auto animation_library::read(const std::string_view uri) -> result<animation_library_source> {
 	jsoncons::json root;
 	if(const auto err = parse_animation_library_json(uri).unwrap(root); err) [[unlikely]] {
 		return error("failed to parse animation library JSON: " + std::string(uri), *err);
 	}
 
 	const auto base_path = std::filesystem::path(static_cast<std::string>(uri)).parent_path();
-	std::string sprite_sheet_path;
-	if(const auto err = parse_sprite_sheet_path(root, base_path).unwrap(sprite_sheet_path); err) [[unlikely]] {
+	animation_library_source source;
+	if(const auto err = parse_sprite_sheet_path(root, base_path).unwrap(source.sprite_sheet_path); err) [[unlikely]] {
 		return error("animation library error getting sprite sheet path: " + std::string(uri), *err);
 	}
 
-	if(const auto err = rm.load_sprite_sheet(sprite_sheet_path).unwrap(sprite_sheet); err) [[unlikely]] {
-		return error("failed to load animation library sprite sheet", *err);
-	}
-
-	if(const auto err = parse_animations(root).unwrap(); err) [[unlikely]] {
+	if(const auto err = parse_animations(root, source.animations).unwrap(); err) [[unlikely]] {
 		return error("failed to parse animation library animations: " + std::string(uri), *err);
 	}
 
-	return true;
+	return source;
 }
 
-auto animation_library::parse_animations(const jsoncons::json &root) -> result<> {
+auto animation_library::parse_animations(const jsoncons::json &root,
+										 std::unordered_map<entt::id_type, animation_library_anim> &animations)
+	-> result<> {
 	for(const auto &frames_node = root["animations"]; const auto &entry: frames_node.object_range()) {
 		const auto &value = entry.value();
 		if(!value.is_object()) {
@@ -18,6 +18,12 @@
 
 namespace lge {
 
+// what an animation library file describes, read on any thread
+struct animation_library_source {
+	std::string sprite_sheet_path;
+	std::unordered_map<entt::id_type, animation_library_anim> animations;
+};
+
 class animation_library {
 public:
 	~animation_library();
@@ -28,13 +34,19 @@ public:
 	auto operator=(animation_library &&) noexcept -> animation_library & = default;
 
 	[[nodiscard]] auto load(std::string_view uri, resource_manager &rm) -> result<>;
+	// from a source read beforehand, loading its sprite sheet asynchronously
+	[[nodiscard]] auto load(std::string_view uri, resource_manager &rm, animation_library_source &&source) -> result<>;
 	sprite_sheet_handle sprite_sheet;
 	std::unordered_map<entt::id_type, animation_library_anim> animations;
 
+	// touches nothing but the file, so it may run on a loader thread
+	[[nodiscard]] static auto read(std::string_view uri) -> result<animation_library_source>;
+
 private:
 	resource_manager *rm_ = nullptr;
 
-	auto parse_animations(const jsoncons::json &root) -> result<>;
+	static auto parse_animations(const jsoncons::json &root,
+								 std::unordered_map<entt::id_type, animation_library_anim> &animations) -> result<>;
 	static auto parse_sprite_sheet_path(const jsoncons::json &root, const std::filesystem::path &base_path)
 		-> result<std::string>;
 	static auto parse_animation_library_json(std::string_view uri) -> result<jsoncons::json>;
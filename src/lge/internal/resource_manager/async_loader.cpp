@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "async_loader.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace lge {
+
+async_loader::async_loader(const std::size_t workers) {
+	threads_.reserve(workers);
+	for(std::size_t i = 0; i < workers; ++i) {
+		threads_.emplace_back([this]() -> void { work(); });
+	}
+}
+
+async_loader::~async_loader() {
+	{
+		const std::scoped_lock lock{mutex_};
+		stopping_ = true;
+		jobs_.clear();
+	}
+	signal_.notify_all();
+
+	for(auto &thread: threads_) {
+		thread.join();
+	}
+}
+
+auto async_loader::submit(job j) -> void {
+	{
+		const std::scoped_lock lock{mutex_};
+		jobs_.push_back(std::move(j));
+		++pending_;
+	}
+	signal_.notify_one();
+}
+
+auto async_loader::complete(const std::size_t max) -> void {
+	for(std::size_t i = 0; i < max; ++i) {
+		finish next;
+		{
+			const std::scoped_lock lock{mutex_};
+			if(!finished_.empty()) {
+				next = std::move(finished_.front());
+				finished_.pop_front();
+			} else if(threads_.empty() && !jobs_.empty()) {
+				// no workers, so the job runs here and its own finish right after
+				next = [j = std::move(jobs_.front())]() -> void { j()(); };
+				jobs_.pop_front();
+			} else {
+				return;
+			}
+		}
+
+		// outside the lock, a finish may submit further jobs, e.g. a sprite sheet its texture
+		next();
+
+		const std::scoped_lock lock{mutex_};
+		--pending_;
+	}
+}
+
+auto async_loader::pending() const -> std::size_t {
+	const std::scoped_lock lock{mutex_};
+	return pending_;
+}
+
+auto async_loader::work() -> void {
+	while(true) {
+		job next;
+		{
+			std::unique_lock lock{mutex_};
+			signal_.wait(lock, [this]() -> bool { return stopping_ || !jobs_.empty(); });
+			if(stopping_) {
+				return;
+			}
+			next = std::move(jobs_.front());
+			jobs_.pop_front();
+		}
+
+		auto done = next();
+
+		const std::scoped_lock lock{mutex_};
+		finished_.push_back(std::move(done));
+	}
+}
+
+} // namespace lge
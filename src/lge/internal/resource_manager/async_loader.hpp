@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Async loader
+//
+// Runs the slow part of loading a resource, reading files, parsing and
+// decoding, on its own threads, away from the frame. Each job returns what is
+// left to do on the main thread, e.g. the GPU upload, and complete runs those
+// from the main thread a few at a time, so a frame never stalls on a batch of
+// loads finishing together. Without threads, on the web, complete runs the
+// jobs themselves, one at a time.
+// =============================================================================
+
+class async_loader {
+public:
+	using finish = std::function<void()>;
+	using job = std::function<finish()>;
+
+	explicit async_loader(std::size_t workers);
+
+	async_loader(const async_loader &) = delete;
+	async_loader(async_loader &&) = delete;
+	auto operator=(const async_loader &) -> async_loader & = delete;
+	auto operator=(async_loader &&) -> async_loader & = delete;
+	// jobs not started yet are dropped, running ones are waited for
+	~async_loader();
+
+	auto submit(job j) -> void;
+
+	// runs up to max of the finished jobs' main thread parts, in the order they finished
+	auto complete(std::size_t max) -> void;
+
+	// jobs submitted and not completed yet
+	[[nodiscard]] auto pending() const -> std::size_t;
+
+private:
+	std::vector<std::thread> threads_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable signal_; // a job was submitted or the loader is stopping
+	std::deque<job> jobs_;
+	std::deque<finish> finished_;
+	std::size_t pending_ = 0;
+	bool stopping_ = false;
+
+	auto work() -> void;
+};
+
+} // namespace lge
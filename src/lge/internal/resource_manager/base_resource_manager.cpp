@@ -1,16 +1,22 @@
 // SPDX-FileCopyrightText: 2026 Juan Medina
 // SPDX-License-Identifier: MIT
 
+#include <lge/core/log.hpp>
 #include <lge/core/result.hpp>
 #include <lge/interface/resources.hpp>
 #include <lge/internal/resource_manager/animation_library.hpp>
+#include <lge/internal/resource_manager/async_loader.hpp>
 #include <lge/internal/resource_manager/base_resource_manager.hpp>
 #include <lge/internal/resource_manager/sprite_sheet.hpp>
 
+#include <cstddef>
 #include <entt/core/fwd.hpp>
 #include <filesystem>
 #include <format>
+#include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 
 namespace lge {
 
@@ -27,6 +33,8 @@ auto base_resource_manager::load_sprite_sheet(const std::string_view uri) -> res
 	if(const auto err = sprite_sheets_.load(uri, *this).unwrap(handle); err) {
 		return error("failed to load sprite sheet", *err);
 	}
+	// it may have been pending, resolved as missing until now
+	bump_texture_generation();
 	return handle;
 }
 
@@ -35,6 +43,8 @@ auto base_resource_manager::unload_sprite_sheet(const sprite_sheet_handle handle
 		return error("failed to unload sprite sheet", *err);
 	}
 
+	// frames resolved from it are stale, a sheet loaded again from the same uri gets a new handle
+	bump_texture_generation();
 	return true;
 }
 
@@ -76,7 +86,7 @@ auto base_resource_manager::unload_animation_library(const animation_library_han
 }
 
 auto base_resource_manager::get_animation(const animation_library_handle handle, const entt::id_type anim_name) const
-	-> result<animation_library_anim> {
+	-> result<const animation_library_anim *> {
 	const animation_library *data = nullptr;
 	if(const auto err = animation_libraries_.get(handle).unwrap(data); err) [[unlikely]] {
 		return error("animation library not found", *err);
@@ -85,7 +95,7 @@ auto base_resource_manager::get_animation(const animation_library_handle handle,
 	if(clip_it == data->animations.end()) [[unlikely]] {
 		return error(std::format("animation clip '{}' not found in animation library", anim_name));
 	}
-	return clip_it->second;
+	return &clip_it->second;
 }
 
 auto base_resource_manager::get_animation_sprite_sheet(const animation_library_handle handle) const
@@ -97,4 +107,117 @@ auto base_resource_manager::get_animation_sprite_sheet(const animation_library_h
 	return data->sprite_sheet;
 }
 
+// =============================================================================
+// Asynchronous loading
+// =============================================================================
+
+auto base_resource_manager::load_sprite_sheet_async(const std::string_view uri) -> result<sprite_sheet_handle> {
+	sprite_sheet_store::reservation reserved;
+	if(const auto err = sprite_sheets_.reserve(uri).unwrap(reserved); err) [[unlikely]] {
+		return error("failed to load sprite sheet", *err);
+	}
+	if(!reserved.is_new) {
+		return reserved.key;
+	}
+
+	submit_load([this, handle = reserved.key, path = std::string(uri)]() -> async_loader::finish {
+		return [this, handle, path, source = sprite_sheet::read(path)]() mutable -> void {
+			if(!sprite_sheets_.is_pending(handle)) {
+				return; // unloaded while it was read
+			}
+			sprite_sheet_source data;
+			if(const auto err = std::move(source).unwrap(data); err) [[unlikely]] {
+				sprite_sheets_.fail(handle, error("failed to load sprite sheet", *err));
+				log::error("failed to load sprite sheet `{}`: {}", path, err->to_string());
+				return;
+			}
+			if(const auto err = sprite_sheets_.finish(handle, path, *this, std::move(data)).unwrap();
+			   err) [[unlikely]] {
+				log::error("failed to load sprite sheet `{}`: {}", path, err->to_string());
+				return;
+			}
+			bump_texture_generation();
+		};
+	});
+	return reserved.key;
+}
+
+auto base_resource_manager::load_animation_library_async(const std::string_view uri)
+	-> result<animation_library_handle> {
+	animation_library_store::reservation reserved;
+	if(const auto err = animation_libraries_.reserve(uri).unwrap(reserved); err) [[unlikely]] {
+		return error("failed to load animation library", *err);
+	}
+	if(!reserved.is_new) {
+		return reserved.key;
+	}
+
+	submit_load([this, handle = reserved.key, path = std::string(uri)]() -> async_loader::finish {
+		return [this, handle, path, source = animation_library::read(path)]() mutable -> void {
+			if(!animation_libraries_.is_pending(handle)) {
+				return; // unloaded while it was read
+			}
+			animation_library_source data;
+			if(const auto err = std::move(source).unwrap(data); err) [[unlikely]] {
+				animation_libraries_.fail(handle, error("failed to load animation library", *err));
+				log::error("failed to load animation library `{}`: {}", path, err->to_string());
+				return;
+			}
+			if(const auto err = animation_libraries_.finish(handle, path, *this, std::move(data)).unwrap();
+			   err) [[unlikely]] {
+				log::error("failed to load animation library `{}`: {}", path, err->to_string());
+			}
+		};
+	});
+	return reserved.key;
+}
+
+auto base_resource_manager::get_load_state(const sprite_sheet_handle handle) const -> load_state {
+	const auto own = sprite_sheets_.state(handle);
+	if(own != load_state::ready) {
+		return own;
+	}
+
+	const sprite_sheet *data = nullptr;
+	if(const auto err = sprite_sheets_.get(handle).unwrap(data); err) [[unlikely]] {
+		return load_state::failed;
+	}
+	// a sheet is only as loaded as its texture
+	return get_load_state(data->texture);
+}
+
+auto base_resource_manager::get_load_state(const animation_library_handle handle) const -> load_state {
+	const auto own = animation_libraries_.state(handle);
+	if(own != load_state::ready) {
+		return own;
+	}
+
+	const animation_library *data = nullptr;
+	if(const auto err = animation_libraries_.get(handle).unwrap(data); err) [[unlikely]] {
+		return load_state::failed;
+	}
+	return get_load_state(data->sprite_sheet);
+}
+
+auto base_resource_manager::update_loads(const std::size_t max_finished) -> void {
+	if(loader_ != nullptr) {
+		loader_->complete(max_finished);
+	}
+}
+
+auto base_resource_manager::pending_loads() const -> std::size_t {
+	return loader_ != nullptr ? loader_->pending() : 0;
+}
+
+auto base_resource_manager::submit_load(async_loader::job job) -> void {
+	if(loader_ == nullptr) [[unlikely]] {
+		loader_ = std::make_unique<async_loader>(loader_threads);
+	}
+	loader_->submit(std::move(job));
+}
+
+auto base_resource_manager::stop_loads() -> void {
+	loader_.reset();
+}
+
 } // namespace lge
\ No newline at end of file
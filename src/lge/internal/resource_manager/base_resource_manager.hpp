@@ -7,10 +7,13 @@
 #include <lge/interface/resource_manager.hpp>
 #include <lge/interface/resources.hpp>
 #include <lge/internal/resource_manager/animation_library.hpp>
+#include <lge/internal/resource_manager/async_loader.hpp>
 #include <lge/internal/resource_manager/sprite_sheet.hpp>
 
 #include <core/fwd.hpp>
+#include <cstddef>
 #include <entt/entt.hpp>
+#include <memory>
 #include <string_view>
 
 namespace lge {
@@ -51,13 +54,40 @@ public:
 	[[nodiscard]] auto load_animation_library(std::string_view uri) -> result<animation_library_handle> override;
 	[[nodiscard]] auto unload_animation_library(animation_library_handle handle) -> result<> override;
 	[[nodiscard]] auto get_animation(animation_library_handle handle, entt::id_type anim_name) const
-		-> result<animation_library_anim> override;
+		-> result<const animation_library_anim *> override;
 	[[nodiscard]] auto get_animation_sprite_sheet(animation_library_handle handle) const
 		-> result<sprite_sheet_handle> override;
 
+	// =============================================================================
+	// Asynchronous loading
+	// =============================================================================
+
+	[[nodiscard]] auto load_sprite_sheet_async(std::string_view uri) -> result<sprite_sheet_handle> override;
+	[[nodiscard]] auto load_animation_library_async(std::string_view uri)
+		-> result<animation_library_handle> override;
+	[[nodiscard]] auto get_load_state(sprite_sheet_handle handle) const -> load_state override;
+	[[nodiscard]] auto get_load_state(animation_library_handle handle) const -> load_state override;
+	using resource_manager::get_load_state;
+
+	auto update_loads(std::size_t max_finished) -> void override;
+	[[nodiscard]] auto pending_loads() const -> std::size_t override;
+
+#ifdef __EMSCRIPTEN__
+	static constexpr std::size_t loader_threads = 0; // no threads on the web, update_loads does the work itself
+#else
+	static constexpr std::size_t loader_threads = 2;
+#endif
+
+protected:
+	// job runs on a loader thread, the finish it returns on the main thread in update_loads
+	auto submit_load(async_loader::job job) -> void;
+	// drops the loads not finished yet, so none finishes once the backend is gone
+	auto stop_loads() -> void;
+
 private:
 	sprite_sheet_store sprite_sheets_;
 	animation_library_store animation_libraries_;
+	std::unique_ptr<async_loader> loader_; // created on the first asynchronous load
 };
 
 } //  namespace lge
@@ -4,15 +4,21 @@
 #pragma once
 
 #include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <entt/core/fwd.hpp>
 #include <entt/entt.hpp>
 #include <format>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace lge {
 
@@ -27,64 +33,245 @@ concept ResourceKey = requires(entt::id_type id, const Key &key) {
 	{ key.raw() } -> std::same_as<entt::id_type>;
 };
 
+// =============================================================================
+// Resource store
+//
+// Resources live in a dense vector of slots, and a key packs the slot index
+// with the slot's generation, so a lookup is a bounds check, an index and a
+// generation compare. Unloading bumps the generation, so a key kept after its
+// resource is gone is detected instead of reaching whatever reuses the slot.
+// The hash of the uri is only consulted on load, so loading the same uri
+// twice shares the resource, counting references.
+// =============================================================================
+
 template<typename T, ResourceKey Key>
 class resource_store {
 public:
+	static constexpr std::uint32_t index_bits = 20;
+	static constexpr std::uint32_t index_mask = (1U << index_bits) - 1U;
+	static constexpr std::uint32_t max_generation = (1U << (32U - index_bits)) - 2U; // all ones would make a null key
+
 	template<typename... Args>
 		requires ResourceData<T, Args...>
 	[[nodiscard]] auto load(std::string_view uri, Args &&...args) -> result<Key> {
-		const auto key = entt::hashed_string{uri.data()}.value(); // NOLINT(*-suspicious-stringview-data-usage)
-		if(const auto it = entries_.find(key); it != entries_.end()) {
-			++it->second.ref_count;
-			return Key::from_id(key);
+		const auto uri_hash = entt::hashed_string{uri.data()}.value(); // NOLINT(*-suspicious-stringview-data-usage)
+		if(const auto it = by_uri_.find(uri_hash); it != by_uri_.end()) {
+			const auto key = it->second;
+			const auto &s = slots_[index_of(key)];
+			if(s.state == load_state::failed) [[unlikely]] {
+				return not_found(key, &s);
+			}
+			// still loading elsewhere, finished here so the key handed back is ready
+			if(s.state == load_state::pending) [[unlikely]] {
+				if(const auto err = finish(key, uri, std::forward<Args>(args)...).unwrap(); err) [[unlikely]] {
+					return *err;
+				}
+			}
+			++slots_[index_of(key)].ref_count;
+			return key;
 		}
+
 		auto res_ptr = std::make_unique<T>();
 		if(const auto err = res_ptr->load(uri, std::forward<Args>(args)...).unwrap(); err) [[unlikely]] {
 			return error{"failed to load resource: " + std::string(uri), *err};
 		}
-		entries_.emplace(key, entry{.resource = std::move(res_ptr), .ref_count = 1});
-		return Key::from_id(key);
+
+		Key key;
+		if(const auto err = allocate(uri, uri_hash).unwrap(key); err) [[unlikely]] {
+			return *err;
+		}
+		auto &s = slots_[index_of(key)];
+		s.resource = std::move(res_ptr);
+		s.state = load_state::ready;
+		return key;
+	}
+
+	// =============================================================================
+	// Loading elsewhere
+	//
+	// reserve hands out the key of a resource loaded later, e.g. once another
+	// thread read its file, and finish or fail settle it. A uri already loaded
+	// or reserved shares its key, as load does, so only a new reservation
+	// starts loading. load never hands out a key that is not ready: it finishes
+	// a pending one there and then, dropping the later work, and reports a
+	// failed one's error.
+	// =============================================================================
+
+	struct reservation {
+		Key key;
+		bool is_new;
+	};
+
+	[[nodiscard]] auto reserve(std::string_view uri) -> result<reservation> {
+		const auto uri_hash = entt::hashed_string{uri.data()}.value(); // NOLINT(*-suspicious-stringview-data-usage)
+		if(const auto it = by_uri_.find(uri_hash); it != by_uri_.end()) {
+			++slots_[index_of(it->second)].ref_count;
+			return reservation{.key = it->second, .is_new = false};
+		}
+
+		Key key;
+		if(const auto err = allocate(uri, uri_hash).unwrap(key); err) [[unlikely]] {
+			return *err;
+		}
+		return reservation{.key = key, .is_new = true};
+	}
+
+	// false when the key is no longer pending, unloaded meanwhile, so the work can be dropped
+	[[nodiscard]] auto is_pending(Key key) const noexcept -> bool {
+		const auto *s = find(key);
+		return s != nullptr && s->state == load_state::pending;
+	}
+
+	template<typename... Args>
+		requires ResourceData<T, Args...>
+	[[nodiscard]] auto finish(Key key, std::string_view uri, Args &&...args) -> result<> {
+		auto *s = find(key);
+		if(s == nullptr || s->state != load_state::pending) [[unlikely]] {
+			return error{std::format("no pending resource with key: {}", key)};
+		}
+
+		auto res_ptr = std::make_unique<T>();
+		if(const auto err = res_ptr->load(uri, std::forward<Args>(args)...).unwrap(); err) [[unlikely]] {
+			auto failure = error{"failed to load resource: " + std::string(uri), *err};
+			fail(key, failure);
+			return failure;
+		}
+
+		// loading may have reserved other resources of this store, moving the slots
+		s = find(key);
+		s->resource = std::move(res_ptr);
+		s->state = load_state::ready;
+		return true;
+	}
+
+	// the key stays taken, reporting the failure, until it is unloaded
+	auto fail(Key key, const error &cause) -> void {
+		if(auto *s = find(key); s != nullptr && s->state == load_state::pending) {
+			s->state = load_state::failed;
+			s->failure = cause;
+		}
+	}
+
+	// failed for keys never handed out or already unloaded
+	[[nodiscard]] auto state(Key key) const noexcept -> load_state {
+		const auto *s = find(key);
+		return s != nullptr ? s->state : load_state::failed;
 	}
 
 	[[nodiscard]] auto unload(Key key) -> result<> {
-		const auto it = entries_.find(key.raw());
-		if(it == entries_.end()) [[unlikely]] {
+		auto *s = find(key);
+		if(s == nullptr) [[unlikely]] {
 			return error{std::format("attempted to unload non-existent resource with key: {}", key)};
 		}
-		if(--it->second.ref_count <= 0) {
-			entries_.erase(it);
+		if(--s->ref_count <= 0) {
+			s->resource.reset();
+			s->failure.reset();
+			by_uri_.erase(s->uri_hash);
+			s->generation = (s->generation % max_generation) + 1U;
+			free_.push_back(index_of(key));
 		}
 		return true;
 	}
 
 	[[nodiscard]] auto get(Key key) const -> result<const T *> {
-		const auto it = entries_.find(key.raw());
-		if(it == entries_.end()) [[unlikely]] {
-			return error{std::format("resource not found with key: {}", key)};
+		const auto *s = find(key);
+		if(s == nullptr || s->resource == nullptr) [[unlikely]] {
+			return not_found(key, s);
 		}
-		return it->second.resource.get();
+		return s->resource.get();
 	}
 
 	[[nodiscard]] auto get(Key key) noexcept -> result<T *> {
-		const auto it = entries_.find(key.raw());
-		if(it == entries_.end()) [[unlikely]] {
-			return error{std::format("resource not found with key: {}", key)};
+		auto *s = find(key);
+		if(s == nullptr || s->resource == nullptr) [[unlikely]] {
+			return not_found(key, s);
 		}
-		return it->second.resource.get();
+		return s->resource.get();
 	}
 
 	auto for_each(std::function<void(const T &)> fn) const -> void {
-		for(const auto &[key, e]: entries_) {
-			fn(*e.resource);
+		for(const auto &s: slots_) {
+			if(s.resource != nullptr) {
+				fn(*s.resource);
+			}
 		}
 	}
 
 private:
-	struct entry {
-		std::unique_ptr<T> resource;
-		int ref_count = 0;
+	struct slot {
+		std::unique_ptr<T> resource;  // null while free, pending or failed
+		int ref_count = 0;			  // 0 while free
+		std::uint32_t generation = 1; // never 0, so no key is 0 either
+		entt::id_type uri_hash = 0;
+		load_state state = load_state::pending;
+		std::optional<error> failure;
 	};
-	std::unordered_map<entt::id_type, entry> entries_;
+
+	std::vector<slot> slots_;
+	std::vector<std::uint32_t> free_;
+	std::unordered_map<entt::id_type, Key> by_uri_;
+
+	[[nodiscard]] static auto index_of(const Key key) noexcept -> std::uint32_t {
+		return key.raw() & index_mask;
+	}
+
+	// a pending slot for a new uri
+	[[nodiscard]] auto allocate(std::string_view uri, const entt::id_type uri_hash) -> result<Key> {
+		std::uint32_t index = 0;
+		if(!free_.empty()) {
+			index = free_.back();
+			free_.pop_back();
+		} else if(slots_.size() <= index_mask) [[likely]] {
+			index = static_cast<std::uint32_t>(slots_.size());
+			slots_.emplace_back();
+		} else {
+			return error{"failed to load resource: " + std::string(uri) + ", the store is full"};
+		}
+
+		auto &s = slots_[index];
+		s.ref_count = 1;
+		s.uri_hash = uri_hash;
+		s.state = load_state::pending;
+
+		const auto key = Key::from_id((s.generation << index_bits) | index);
+		by_uri_.emplace(uri_hash, key);
+		return key;
+	}
+
+	[[nodiscard]] static auto not_found(const Key key, const slot *s) -> error {
+		if(s != nullptr && s->failure) {
+			return error{std::format("resource with key {} failed to load", key), *s->failure};
+		}
+		if(s != nullptr) {
+			return error{std::format("resource with key {} is still loading", key)};
+		}
+		return error{std::format("resource not found with key: {}", key)};
+	}
+
+	// null for keys never handed out, null keys and keys of unloaded resources
+	[[nodiscard]] auto find(const Key key) const noexcept -> const slot * {
+		const auto index = index_of(key);
+		if(index >= slots_.size()) [[unlikely]] {
+			return nullptr;
+		}
+		const auto &s = slots_[index];
+		if(s.generation != (key.raw() >> index_bits) || s.ref_count <= 0) [[unlikely]] {
+			return nullptr;
+		}
+		return &s;
+	}
+
+	[[nodiscard]] auto find(const Key key) noexcept -> slot * {
+		const auto index = index_of(key);
+		if(index >= slots_.size()) [[unlikely]] {
+			return nullptr;
+		}
+		auto &s = slots_[index];
+		if(s.generation != (key.raw() >> index_bits) || s.ref_count <= 0) [[unlikely]] {
+			return nullptr;
+		}
+		return &s;
+	}
 };
 
 } // namespace lge
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include <string_view>
 #include <system_error>
 #include <unordered_map>
+#include <utility>
 
 namespace lge {
 
@@ -33,6 +34,31 @@ sprite_sheet::~sprite_sheet() {
 auto sprite_sheet::load(const std::string_view uri, resource_manager &rm) -> result<> {
 	rm_ = &rm;
 
+	sprite_sheet_source source;
+	if(const auto err = read(uri).unwrap(source); err) [[unlikely]] {
+		return *err;
+	}
+
+	if(const auto err = rm.load_texture(source.image_path).unwrap(texture); err) [[unlikely]] {
+		return error{"failed to load sprite sheet texture", *err};
+	}
+
+	frames = std::move(source.frames);
+	return true;
+}
+
+auto sprite_sheet::load(const std::string_view uri, resource_manager &rm, sprite_sheet_source &&source) -> result<> {
+	rm_ = &rm;
+
+	if(const auto err = rm.load_texture_async(source.image_path).unwrap(texture); err) [[unlikely]] {
+		return error{"failed to load sprite sheet texture for: " + std::string(uri), *err};
+	}
+
+	frames = std::move(source.frames);
+	return true;
+}
+
+auto sprite_sheet::read(const std::string_view uri) -> result<sprite_sheet_source> {
 	jsoncons::json root;
 	if(const auto err = parse_sprite_sheet_json(uri).unwrap(root); err) [[unlikely]] {
 		return error{"failed to parse sprite sheet JSON: " + std::string(uri), *err};
@@ -40,23 +66,21 @@ auto sprite_sheet::load(const std::string_view uri, resource_manager &rm) -> res
 
 	const auto base_path = std::filesystem::path(static_cast<std::string>(uri)).parent_path();
 
-	std::string image_path;
-	if(const auto err = parse_sprite_sheet_image_path(root, base_path).unwrap(image_path); err) [[unlikely]] {
+	sprite_sheet_source source;
+	if(const auto err = parse_sprite_sheet_image_path(root, base_path).unwrap(source.image_path); err) [[unlikely]] {
 		return error{"failed to parse sprite sheet image path: " + std::string(uri), *err};
 	}
 
-	if(const auto err = rm.load_texture(image_path).unwrap(texture); err) [[unlikely]] {
-		return error{"failed to load sprite sheet texture", *err};
-	}
-
-	if(const auto err = parse_sprite_sheet_frames(root).unwrap(); err) [[unlikely]] {
+	if(const auto err = parse_sprite_sheet_frames(root, source.frames).unwrap(); err) [[unlikely]] {
 		return error{"failed to parse sprite sheet frames: " + std::string(uri), *err};
 	}
 
-	return true;
+	return source;
 }
 
-auto sprite_sheet::parse_sprite_sheet_frames(const jsoncons::json &root) -> result<> {
+auto sprite_sheet::parse_sprite_sheet_frames(const jsoncons::json &root,
+											 std::unordered_map<entt::id_type, sprite_sheet_frame> &frames)
+	-> result<> {
 	if(!root.contains("frames") || !root["frames"].is_object()) {
 		return error{"missing sprite sheet frames"};
 	}
@@ -18,6 +18,12 @@
 
 namespace lge {
 
+// what a sprite sheet file describes, read on any thread
+struct sprite_sheet_source {
+	std::string image_path;
+	std::unordered_map<entt::id_type, sprite_sheet_frame> frames;
+};
+
 class sprite_sheet {
 public:
 	~sprite_sheet();
@@ -28,12 +34,18 @@ public:
 	auto operator=(sprite_sheet &&) noexcept -> sprite_sheet & = default;
 
 	[[nodiscard]] auto load(std::string_view uri, resource_manager &rm) -> result<>;
+	// from a source read beforehand, loading its texture asynchronously
+	[[nodiscard]] auto load(std::string_view uri, resource_manager &rm, sprite_sheet_source &&source) -> result<>;
 	texture_handle texture;
 	std::unordered_map<entt::id_type, sprite_sheet_frame> frames;
 
+	// touches nothing but the file, so it may run on a loader thread
+	[[nodiscard]] static auto read(std::string_view uri) -> result<sprite_sheet_source>;
+
 private:
 	resource_manager *rm_ = nullptr;
-	auto parse_sprite_sheet_frames(const jsoncons::json &root) -> result<>;
+	static auto parse_sprite_sheet_frames(const jsoncons::json &root,
+										  std::unordered_map<entt::id_type, sprite_sheet_frame> &frames) -> result<>;
 	static auto parse_sprite_sheet_image_path(const jsoncons::json &root, const std::filesystem::path &base_path)
 		-> result<std::string>;
 	static auto parse_sprite_sheet_json(std::string_view uri) -> result<jsoncons::json>;
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "system_scheduler.hpp"
+
+#include <lge/systems/system.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace lge {
+
+auto system_scheduler::build(const std::span<const std::unique_ptr<system>> systems, entt::registry &world) -> void {
+	for(auto &phase_batches: batches_) {
+		phase_batches.clear();
+	}
+
+	std::vector<system_access> accesses;
+	accesses.reserve(systems.size());
+	for(const auto &s: systems) {
+		accesses.push_back(s->access());
+		accesses.back().prepare(world);
+	}
+
+	levels_.assign(systems.size(), 0);
+	for(std::size_t i = 0; i < systems.size(); ++i) {
+		const auto p = systems[i]->get_phase();
+
+		auto level = std::size_t{0};
+		for(std::size_t j = 0; j < i; ++j) {
+			if(systems[j]->get_phase() == p && accesses[i].conflicts_with(accesses[j])) {
+				level = std::max(level, levels_[j] + 1);
+			}
+		}
+		levels_[i] = level;
+
+		auto &phase_batches = batches_.at(static_cast<std::size_t>(p));
+		if(phase_batches.size() <= level) {
+			phase_batches.resize(level + 1);
+		}
+		phase_batches[level].push_back(i);
+	}
+}
+
+} // namespace lge
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/systems/system.hpp>
+
+#include <array>
+#include <cstddef>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// System scheduler
+//
+// Splits the systems of each phase into batches from their declared access.
+// A system goes in the batch after the last earlier system it conflicts with,
+// so conflicting systems keep their registration order while the systems of
+// one batch touch disjoint data and may run at the same time, giving the same
+// results as running them one after the other.
+// =============================================================================
+
+class system_scheduler {
+public:
+	using batch = std::vector<std::size_t>; // indices into the systems it was built from
+
+	// also creates every declared component storage, systems must not create them while running together
+	auto build(std::span<const std::unique_ptr<system>> systems, entt::registry &world) -> void;
+
+	[[nodiscard]] auto batches_of(phase p) const -> std::span<const batch> {
+		return batches_.at(static_cast<std::size_t>(p));
+	}
+
+private:
+	std::array<std::vector<batch>, 5> batches_; // indexed by phase
+	std::vector<std::size_t> levels_;
+};
+
+} // namespace lge
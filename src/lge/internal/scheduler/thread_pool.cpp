@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace lge {
+
+namespace {
+
+// the pool and queue of the worker running on this thread, if any
+thread_local const thread_pool *current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+} // namespace
+
+thread_pool::thread_pool(const std::size_t workers) {
+	queues_.reserve(workers + 1);
+	for(std::size_t i = 0; i <= workers; ++i) {
+		queues_.push_back(std::make_unique<queue>());
+	}
+
+	threads_.reserve(workers);
+	for(std::size_t i = 0; i < workers; ++i) {
+		threads_.emplace_back([this, i]() -> void { work(i); });
+	}
+}
+
+thread_pool::~thread_pool() {
+	{
+		const std::scoped_lock lock{mutex_};
+		stopping_ = true;
+	}
+	signal_.notify_all();
+
+	for(auto &thread: threads_) {
+		thread.join();
+	}
+}
+
+auto thread_pool::run(const std::size_t count, const std::function<void(std::size_t)> &task) -> void {
+	if(count == 0) [[unlikely]] {
+		return;
+	}
+
+	job current{.task = &task, .pending = count};
+
+	// counted before they are queued, so it never drops below the items really there
+	{
+		const std::scoped_lock lock{mutex_};
+		available_ += count;
+	}
+
+	// round robin starting with our own queue, so the first task never waits for a worker to wake up
+	const auto own = own_queue();
+	for(std::size_t i = 0; i < count; ++i) {
+		auto &target = *queues_[(own + i) % queues_.size()];
+		const std::scoped_lock lock{target.mutex};
+		target.items.push_back({.owner = &current, .index = i});
+	}
+	signal_.notify_all();
+
+	// help with whatever is queued, ours or not, until every task of this job is done
+	while(current.pending.load(std::memory_order_acquire) != 0) {
+		if(item it{}; try_pop(own, it)) {
+			execute(it);
+			continue;
+		}
+
+		std::unique_lock lock{mutex_};
+		signal_.wait(lock, [this, &current]() -> bool {
+			return current.pending.load(std::memory_order_acquire) == 0 || available_ != 0;
+		});
+	}
+}
+
+auto thread_pool::work(const std::size_t index) -> void {
+	current_pool = this;
+	current_queue = index;
+
+	while(true) {
+		if(item it{}; try_pop(index, it)) {
+			execute(it);
+			continue;
+		}
+
+		std::unique_lock lock{mutex_};
+		signal_.wait(lock, [this]() -> bool { return stopping_ || available_ != 0; });
+		if(stopping_) {
+			return;
+		}
+	}
+}
+
+auto thread_pool::execute(const item &it) -> void {
+	(*it.owner->task)(it.index);
+
+	// the owner may return as soon as pending reaches zero, so the job is not touched after this
+	if(it.owner->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		const std::scoped_lock lock{mutex_};
+		signal_.notify_all();
+	}
+}
+
+auto thread_pool::own_queue() const -> std::size_t {
+	return current_pool == this ? current_queue : queues_.size() - 1;
+}
+
+auto thread_pool::try_pop(const std::size_t index, item &it) -> bool {
+	const auto taken = [this, &it](queue &from, const bool front) -> bool {
+		const std::scoped_lock lock{from.mutex};
+		if(from.items.empty()) {
+			return false;
+		}
+		if(front) {
+			it = from.items.front();
+			from.items.pop_front();
+		} else {
+			it = from.items.back();
+			from.items.pop_back();
+		}
+		const std::scoped_lock count_lock{mutex_};
+		--available_;
+		return true;
+	};
+
+	if(taken(*queues_[index], true)) {
+		return true;
+	}
+
+	for(std::size_t offset = 1; offset < queues_.size(); ++offset) {
+		if(taken(*queues_[(index + offset) % queues_.size()], false)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // namespace lge
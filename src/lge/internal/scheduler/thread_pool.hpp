@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lge {
+
+// =============================================================================
+// Thread pool
+//
+// A fixed set of workers, each with its own queue of tasks. A worker takes
+// from the front of its own queue and, once it is empty, steals from the back
+// of the others, so an uneven batch still keeps every thread busy. The thread
+// calling run works on the batch too and returns once it is done, so a task
+// may itself call run, e.g. a system splitting its work while it runs in a
+// batch with others.
+//
+// One pool lives in the registry context when systems run in parallel.
+// =============================================================================
+
+class thread_pool {
+public:
+	explicit thread_pool(std::size_t workers);
+
+	thread_pool(const thread_pool &) = delete;
+	thread_pool(thread_pool &&) = delete;
+	auto operator=(const thread_pool &) -> thread_pool & = delete;
+	auto operator=(thread_pool &&) -> thread_pool & = delete;
+	~thread_pool();
+
+	[[nodiscard]] auto workers() const noexcept -> std::size_t {
+		return threads_.size();
+	}
+
+	// calls task(i) for every i in [0, count), from any thread, and waits for all of them
+	auto run(std::size_t count, const std::function<void(std::size_t)> &task) -> void;
+
+private:
+	struct job {
+		const std::function<void(std::size_t)> *task;
+		std::atomic<std::size_t> pending;
+	};
+
+	struct item {
+		job *owner;
+		std::size_t index;
+	};
+
+	struct queue {
+		std::mutex mutex;
+		std::deque<item> items;
+	};
+
+	std::vector<std::thread> threads_;
+	std::vector<std::unique_ptr<queue>> queues_; // one per worker, the last one for other threads
+
+	std::mutex mutex_;
+	std::condition_variable signal_; // an item was queued or a job finished
+	std::size_t available_ = 0;
+	bool stopping_ = false;
+
+	auto work(std::size_t index) -> void;
+	auto execute(const item &it) -> void;
+	[[nodiscard]] auto own_queue() const -> std::size_t;
+	[[nodiscard]] auto try_pop(std::size_t index, item &it) -> bool;
+};
+
+} // namespace lge
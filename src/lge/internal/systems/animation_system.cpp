@@ -45,22 +45,19 @@ auto animation_system::advance_animation(const entt::entity entity, sprite_anima
 		}
 	}
 
-	animation_library_anim clip{};
+	const animation_library_anim *clip = nullptr;
 	if(const auto err = ctx.resources.get_animation(anim.handle, anim.name).unwrap(clip); err) [[unlikely]] {
 		log::error("animation clip '{}' not found, skipping", anim.name.data());
 		return;
 	}
 
 	anim.elapsed += dt;
-	const auto frame_duration = 1.F / clip.fps;
+	const auto frame_duration = 1.F / clip->fps;
 	if(anim.elapsed >= frame_duration) [[unlikely]] {
 		anim.elapsed -= frame_duration;
-		anim.current_frame = (anim.current_frame + 1) % static_cast<int>(clip.frames.size());
+		anim.current_frame = (anim.current_frame + 1) % static_cast<int>(clip->frames.size());
 	}
-	spr.frame = clip.frames[static_cast<std::size_t>(anim.current_frame)];
-	;
-
-	spr.frame = clip.frames[static_cast<std::size_t>(anim.current_frame)];
+	spr.frame = clip->frames[static_cast<std::size_t>(anim.current_frame)];
 }
 
 auto animation_system::update(const float dt) -> result<> {
@@ -9,15 +9,16 @@
 #include <lge/internal/components/metrics.hpp>
 #include <lge/internal/components/transform.hpp>
 
-#include <cmath>
 #include <entt/entt.hpp>
-#include <glm/ext/matrix_float3x3.hpp>
+#include <glm/common.hpp>
 #include <glm/ext/vector_float2.hpp>
-#include <glm/ext/vector_float3.hpp>
-#include <glm/geometric.hpp>
 
 namespace lge {
 
+auto bounds_system::access() const -> system_access {
+	return system_access{}.read<metrics, placement, transform>().write<bounds>();
+}
+
 auto bounds_system::update(const float /*dt*/) -> result<> {
 	for(const auto entity: ctx.world.view<metrics, placement, transform>()) {
 		const auto &m = ctx.world.get<metrics>(entity);
@@ -25,13 +26,10 @@ auto bounds_system::update(const float /*dt*/) -> result<> {
 		const auto &tf = ctx.world.get<transform>(entity);
 
 		// Pivot in world space — identical to what render_system does for every shape.
-		const auto pivot_world = transform_point(tf.world, plc.pivot * m.size);
-
-		// Scale and rotation extracted from the world matrix.
-		const auto world_scale = get_scale(tf.world);
-		const auto rotation_rad = get_rotation_rad(tf.world);
-		const auto cr = std::cos(rotation_rad);
-		const auto sr = std::sin(rotation_rad);
+		const auto pivot_world = tf.apply(plc.pivot * m.size);
+		const auto world_scale = glm::abs(tf.scale);
+		const auto cr = tf.cos;
+		const auto sr = tf.sin;
 
 		// Local corners relative to pivot (same as the old bounds_system local coords).
 		const auto pivot_to_top_left = -plc.pivot * m.size;
@@ -58,21 +56,4 @@ auto bounds_system::update(const float /*dt*/) -> result<> {
 	return true;
 }
 
-auto bounds_system::transform_point(const glm::mat3 &m, const glm::vec2 &p) noexcept -> glm::vec2 {
-	const auto r = m * glm::vec3{p.x, p.y, 1.F};
-	return {r.x, r.y};
-}
-
-auto bounds_system::get_scale(const glm::mat3 &m) noexcept -> glm::vec2 {
-	return {
-		glm::length(glm::vec2{m[0][0], m[0][1]}),
-		glm::length(glm::vec2{m[1][0], m[1][1]}),
-	};
-}
-
-auto bounds_system::get_rotation_rad(const glm::mat3 &m) noexcept -> float {
-	const auto sx = glm::length(glm::vec2{m[0][0], m[1][0]});
-	return std::atan2(m[1][0] / sx, m[0][0] / sx);
-}
-
 } // namespace lge
\ No newline at end of file
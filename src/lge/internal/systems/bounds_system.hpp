@@ -7,7 +7,6 @@
 #include <lge/systems/system.hpp>
 
 #include <entity/fwd.hpp>
-#include <glm/fwd.hpp>
 
 namespace lge {
 
@@ -15,11 +14,7 @@ class bounds_system: public system {
 public:
 	using system::system;
 	auto update(float dt) -> result<> override;
-
-private:
-	[[nodiscard]] static auto transform_point(const glm::mat3 &m, const glm::vec2 &p) noexcept -> glm::vec2;
-	[[nodiscard]] static auto get_scale(const glm::mat3 &m) noexcept -> glm::vec2;
-	[[nodiscard]] static auto get_rotation_rad(const glm::mat3 &m) noexcept -> float;
+	[[nodiscard]] auto access() const -> system_access override;
 };
 
 } // namespace lge
\ No newline at end of file
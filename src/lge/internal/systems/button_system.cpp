@@ -13,18 +13,19 @@
 
 #include <entt/entity/fwd.hpp>
 #include <entt/entt.hpp>
+#include <span>
 
 namespace lge {
 
 auto button_system::init() -> result<> {
 	ctx.world.on_construct<button>().connect<&button_system::on_button_constructed>(this);
 
-	click_sub_ = ctx.events.subscribe<click>([this](const click &c) -> result<> {
-		if(!ctx.world.all_of<button>(c.entity)) {
-			return true;
-		}
-		if(const auto err = ctx.events.post(button_clicked{.entity = c.entity}).unwrap(); err) [[unlikely]] {
-			return error("failed to post button_clicked event", *err);
+	// clicks are queued, so they arrive here together when the app drains the events
+	click_sub_ = ctx.events.subscribe_batch<click>([this](const std::span<const click> clicks) -> result<> {
+		for(const auto &c: clicks) {
+			if(ctx.world.all_of<button>(c.entity)) {
+				ctx.events.enqueue(button_clicked{.entity = c.entity});
+			}
 		}
 		return true;
 	});
@@ -53,9 +54,7 @@ auto button_system::update(const float /*dt*/) -> result<> {
 			continue;
 		}
 		if(ctx.actions.get_button_state(btn.controller_button).pressed) {
-			if(const auto err = ctx.events.post(button_clicked{.entity = entity}).unwrap(); err) [[unlikely]] {
-				return *err;
-			}
+			ctx.events.enqueue(button_clicked{.entity = entity});
 		}
 	}
 
@@ -3,108 +3,261 @@
 
 #include "collision_system.hpp"
 
+#include <lge/app/context.hpp>
 #include <lge/components/collidable.hpp>
 #include <lge/core/result.hpp>
 #include <lge/events/collision.hpp>
+#include <lge/events/collision_ended.hpp>
+#include <lge/internal/collision/narrow_phase.hpp>
+#include <lge/internal/collision/spatial_grid.hpp>
 #include <lge/internal/components/bounds.hpp>
+#include <lge/internal/components/broadphase_proxy.hpp>
 #include <lge/internal/components/overlapping.hpp>
+#include <lge/systems/system.hpp>
 
 #include <algorithm>
-#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <entity/fwd.hpp>
 #include <entt/entt.hpp>
+#include <glm/common.hpp>
 #include <glm/ext/vector_float2.hpp>
-#include <glm/geometric.hpp>
-#include <limits>
+#include <glm/ext/vector_int2.hpp>
+#include <span>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace lge {
 
+collision_system::collision_system(const phase p, context &ctx, const float cell_size)
+	: system(p, ctx), cell_size_{cell_size} {
+	ctx.world.on_destroy<broadphase_proxy>().connect<&collision_system::on_proxy_destroyed>(this);
+}
+
 auto collision_system::update(const float /*dt*/) -> result<> {
 	current_collisions_.clear();
-
-	const auto view = ctx.world.view<collidable, bounds>();
-	const auto entities = std::vector(view.begin(), view.end());
+	current_pairs_.clear();
 
 	for(const auto entity: ctx.world.view<overlapping>()) {
 		ctx.world.remove<overlapping>(entity);
 	}
 
-	for(size_t i = 0; i < entities.size(); ++i) {
-		for(size_t j = i + 1; j < entities.size(); ++j) {
-			const auto a = entities[i];
-			const auto b = entities[j];
-
-			if(overlaps(ctx.world.get<bounds>(a), ctx.world.get<bounds>(b))) {
-				ctx.world.emplace_or_replace<overlapping>(a);
-				ctx.world.emplace_or_replace<overlapping>(b);
-				current_collisions_.push_back({.first = a, .second = b});
+	update_broadphase();
+
+	for(size_t g = 0; g < groups_.size(); ++g) {
+		const auto &group = groups_[g];
+		if((group.layer & group.mask) != 0) {
+			group.grid.for_each_cell(
+				[this](const glm::ivec2 &cell, const std::span<const entt::entity> entities) -> void {
+					find_collisions_in_cell(cell, entities);
+				});
+		}
+
+		for(size_t h = g + 1; h < groups_.size(); ++h) {
+			const auto &other = groups_[h];
+			if((group.layer & other.mask) == 0 || (other.layer & group.mask) == 0) {
+				continue;
 			}
+
+			// walk the sparser grid and look up the same cell in the other one
+			const auto &walked = group.grid.cell_count() <= other.grid.cell_count() ? group : other;
+			const auto &looked_up = &walked == &group ? other : group;
+			walked.grid.for_each_cell(
+				[this, &looked_up](const glm::ivec2 &cell, const std::span<const entt::entity> entities) -> void {
+					find_collisions_between(cell, entities, looked_up.grid.entities_in(cell));
+				});
 		}
 	}
 
+	for(const auto &group: groups_) {
+		for(const auto entity: group.grid.oversized()) {
+			find_collisions_of_oversized(entity);
+		}
+	}
+
+	queue_changes();
+
+	std::swap(previous_collisions_, current_collisions_);
+	std::swap(previous_pairs_, current_pairs_);
+	return true;
+}
+
+// handlers run when the app drains the events, not while the broadphase is being walked
+auto collision_system::queue_changes() const -> void {
 	for(const auto &col: current_collisions_) {
-		const auto already = std::ranges::any_of(previous_collisions_, [&](const collision &prev) -> bool {
-			return (prev.first == col.first && prev.second == col.second)
-				   || (prev.first == col.second && prev.second == col.first);
-		});
-		if(!already) [[likely]] {
-			if(const auto err = ctx.events.post(col).unwrap(); err) [[unlikely]] {
-				return error("failed to post collision event", *err);
+		if(!previous_pairs_.contains(pair_key(col))) [[unlikely]] {
+			ctx.events.enqueue(col);
+		}
+	}
+
+	for(const auto &col: previous_collisions_) {
+		if(!current_pairs_.contains(pair_key(col))) [[unlikely]] {
+			ctx.events.enqueue(collision_ended{.first = col.first, .second = col.second});
+		}
+	}
+}
+
+auto collision_system::group_of(const std::uint32_t layer) -> layer_group & {
+	if(const auto it = std::ranges::find(groups_, layer, &layer_group::layer); it != groups_.end()) [[likely]] {
+		return *it;
+	}
+	return groups_.emplace_back(layer_group{.layer = layer, .mask = 0U, .grid = spatial_grid{cell_size_}});
+}
+
+auto collision_system::update_broadphase() -> void {
+	// entities that are no longer collidable leave the grid through on_proxy_destroyed
+	for(const auto entity: ctx.world.view<broadphase_proxy>(entt::exclude<collidable>)) {
+		ctx.world.remove<broadphase_proxy>(entity);
+	}
+	for(const auto entity: ctx.world.view<broadphase_proxy>(entt::exclude<bounds>)) {
+		ctx.world.remove<broadphase_proxy>(entity);
+	}
+
+	for(auto &group: groups_) {
+		group.mask = 0U;
+	}
+
+	for(const auto &[entity, col, b]: ctx.world.view<collidable, bounds>().each()) {
+		auto &group = group_of(col.layer);
+		group.mask |= col.mask;
+
+		auto proxy = aabb_of(b);
+		proxy.cells = group.grid.range_of(proxy.min, proxy.max);
+		proxy.layer = col.layer;
+		proxy.mask = col.mask;
+
+		if(auto *current = ctx.world.try_get<broadphase_proxy>(entity); current != nullptr) [[likely]] {
+			// most entities stay within the same cells and layer from one frame to the next
+			if(current->layer != proxy.layer) [[unlikely]] {
+				group_of(current->layer).grid.remove(entity, current->cells);
+				group_of(proxy.layer).grid.insert(entity, proxy.cells);
+			} else if(current->cells != proxy.cells) [[unlikely]] {
+				group.grid.remove(entity, current->cells);
+				group.grid.insert(entity, proxy.cells);
 			}
+			*current = proxy;
+		} else {
+			group.grid.insert(entity, proxy.cells);
+			ctx.world.emplace<broadphase_proxy>(entity, proxy);
 		}
 	}
+}
 
-	previous_collisions_ = current_collisions_;
-	return true;
+auto collision_system::find_collisions_in_cell(const glm::ivec2 &cell, const std::span<const entt::entity> entities)
+	-> void {
+	for(size_t i = 0; i < entities.size(); ++i) {
+		test_candidates(cell, entities[i], entities.subspan(i + 1));
+	}
 }
 
-auto collision_system::sat_overlap(const std::array<glm::vec2, 3> &tri_a,
-								   const std::array<glm::vec2, 3> &tri_b) noexcept -> bool {
-	for(size_t i = 0; i < 3; ++i) {
-		const auto edge = tri_a[(i + 1) % 3] - tri_a[i];
-		const auto axis = glm::vec2{-edge.y, edge.x};
+auto collision_system::find_collisions_between(const glm::ivec2 &cell,
+											   const std::span<const entt::entity> entities,
+											   const std::span<const entt::entity> others) -> void {
+	if(others.empty()) {
+		return;
+	}
+	for(const auto entity: entities) {
+		test_candidates(cell, entity, others);
+	}
+}
 
-		auto min_a = std::numeric_limits<float>::max();
-		auto max_a = std::numeric_limits<float>::lowest();
-		for(const auto &v: tri_a) {
-			const auto proj = glm::dot(v, axis);
-			min_a = std::min(min_a, proj);
-			max_a = std::max(max_a, proj);
+auto collision_system::test_candidates(const glm::ivec2 &cell,
+									   const entt::entity entity,
+									   const std::span<const entt::entity> others) -> void {
+	const auto &proxy = ctx.world.get<broadphase_proxy>(entity);
+
+	candidates_.clear();
+	candidate_quads_.clear();
+	for(const auto other: others) {
+		const auto &other_proxy = ctx.world.get<broadphase_proxy>(other);
+
+		// a pair sharing several cells is only tested in the first one
+		if(!compatible(proxy, other_proxy) || !is_first_shared_cell(cell, proxy.cells, other_proxy.cells)
+		   || !aabb_overlap(proxy, other_proxy)) {
+			continue;
 		}
+		candidates_.push_back(other);
+		candidate_quads_.push(ctx.world.get<bounds>(other));
+	}
 
-		auto min_b = std::numeric_limits<float>::max();
-		auto max_b = std::numeric_limits<float>::lowest();
-		for(const auto &v: tri_b) {
-			const auto proj = glm::dot(v, axis);
-			min_b = std::min(min_b, proj);
-			max_b = std::max(max_b, proj);
+	test_narrow_phase(entity);
+}
+
+// listed in no cell, so it is tested against every proxy, of any group
+auto collision_system::find_collisions_of_oversized(const entt::entity entity) -> void {
+	const auto &proxy = ctx.world.get<broadphase_proxy>(entity);
+
+	candidates_.clear();
+	candidate_quads_.clear();
+	for(const auto &[other, other_proxy]: ctx.world.view<broadphase_proxy>().each()) {
+		// two oversized entities find each other, so only the lower one tests the pair
+		if(other == entity
+		   || (spatial_grid::is_oversized(other_proxy.cells) && entt::to_integral(other) < entt::to_integral(entity))) {
+			continue;
+		}
+		if(!compatible(proxy, other_proxy) || !aabb_overlap(proxy, other_proxy)) {
+			continue;
 		}
+		candidates_.push_back(other);
+		candidate_quads_.push(ctx.world.get<bounds>(other));
+	}
+
+	test_narrow_phase(entity);
+}
+
+auto collision_system::test_narrow_phase(const entt::entity entity) -> void {
+	if(candidates_.empty()) [[likely]] {
+		return;
+	}
+
+	hits_.resize(candidates_.size());
+	quads_overlap_batch(ctx.world.get<bounds>(entity), candidate_quads_, hits_);
 
-		if(max_a < min_b || max_b < min_a) {
-			return false;
+	for(size_t i = 0; i < candidates_.size(); ++i) {
+		if(hits_[i] == 0) {
+			continue;
 		}
+		const auto col = collision{.first = entity, .second = candidates_[i]};
+		ctx.world.emplace_or_replace<overlapping>(col.first);
+		ctx.world.emplace_or_replace<overlapping>(col.second);
+		current_collisions_.push_back(col);
+		current_pairs_.insert(pair_key(col));
 	}
-	return true;
 }
 
-auto collision_system::triangles_intersect(const glm::vec2 &a0,
-										   const glm::vec2 &a1,
-										   const glm::vec2 &a2,
-										   const glm::vec2 &b0,
-										   const glm::vec2 &b1,
-										   const glm::vec2 &b2) noexcept -> bool {
-	const std::array ta{a0, a1, a2};
-	const std::array tb{b0, b1, b2};
-	return sat_overlap(ta, tb) && sat_overlap(tb, ta);
+auto collision_system::on_proxy_destroyed(entt::registry & /*world*/, const entt::entity entity) -> void {
+	const auto &proxy = ctx.world.get<broadphase_proxy>(entity);
+	group_of(proxy.layer).grid.remove(entity, proxy.cells);
+}
+
+auto collision_system::pair_key(const collision &col) noexcept -> std::uint64_t {
+	const auto a = static_cast<std::uint64_t>(entt::to_integral(col.first));
+	const auto b = static_cast<std::uint64_t>(entt::to_integral(col.second));
+	return (std::min(a, b) << 32U) | std::max(a, b);
+}
+
+auto collision_system::compatible(const broadphase_proxy &a, const broadphase_proxy &b) noexcept -> bool {
+	return (a.layer & b.mask) != 0 && (b.layer & a.mask) != 0;
+}
+
+auto collision_system::aabb_of(const bounds &b) noexcept -> broadphase_proxy {
+	return broadphase_proxy{
+		.min = glm::min(glm::min(b.p0, b.p1), glm::min(b.p2, b.p3)),
+		.max = glm::max(glm::max(b.p0, b.p1), glm::max(b.p2, b.p3)),
+		.cells = {},
+		.layer = 0U,
+		.mask = 0U,
+	};
+}
+
+auto collision_system::aabb_overlap(const broadphase_proxy &a, const broadphase_proxy &b) noexcept -> bool {
+	return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y;
 }
 
-auto collision_system::overlaps(const bounds &a, const bounds &b) noexcept -> bool {
-	// each world-space quad splits into two triangles: (p0,p1,p3) and (p1,p2,p3)
-	return triangles_intersect(a.p0, a.p1, a.p3, b.p0, b.p1, b.p3)
-		   || triangles_intersect(a.p0, a.p1, a.p3, b.p1, b.p2, b.p3)
-		   || triangles_intersect(a.p1, a.p2, a.p3, b.p0, b.p1, b.p3)
-		   || triangles_intersect(a.p1, a.p2, a.p3, b.p1, b.p2, b.p3);
+auto collision_system::is_first_shared_cell(const glm::ivec2 &cell, const cell_range &a, const cell_range &b) noexcept
+	-> bool {
+	return cell.x == std::max(a.min.x, b.min.x) && cell.y == std::max(a.min.y, b.min.y);
 }
 
 } // namespace lge
\ No newline at end of file
@@ -3,38 +3,77 @@
 
 #pragma once
 
+#include <lge/app/context.hpp>
 #include <lge/core/result.hpp>
 #include <lge/events/collision.hpp>
+#include <lge/internal/collision/narrow_phase.hpp>
+#include <lge/internal/collision/spatial_grid.hpp>
 #include <lge/internal/components/bounds.hpp>
+#include <lge/internal/components/broadphase_proxy.hpp>
 #include <lge/systems/system.hpp>
 
-#include <array>
+#include <cstdint>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
 #include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_int2.hpp>
+#include <span>
+#include <unordered_set>
 #include <vector>
 
 namespace lge {
 
 class collision_system: public system {
 public:
-	using system::system;
+	static constexpr auto default_cell_size = 64.F;
+
+	explicit collision_system(phase p, context &ctx, float cell_size = default_cell_size);
 
 	[[nodiscard]] auto update(float) -> result<> override;
 
 private:
+	// pairs overlapping in the last and the current frame, in detection order and as order-independent keys
 	std::vector<collision> previous_collisions_;
 	std::vector<collision> current_collisions_;
+	std::unordered_set<std::uint64_t> previous_pairs_;
+	std::unordered_set<std::uint64_t> current_pairs_;
+
+	// collidables sharing the same layer bits, so incompatible groups are skipped without visiting their members
+	struct layer_group {
+		std::uint32_t layer;
+		std::uint32_t mask;
+		spatial_grid grid;
+	};
+
+	float cell_size_;
+	std::vector<layer_group> groups_;
+
+	// narrow phase scratch: candidates of one entity that passed the broadphase filters
+	std::vector<entt::entity> candidates_;
+	quad_batch candidate_quads_;
+	std::vector<std::uint8_t> hits_;
 
-	[[nodiscard]] static auto sat_overlap(const std::array<glm::vec2, 3> &tri_a,
-										  const std::array<glm::vec2, 3> &tri_b) noexcept -> bool;
+	auto group_of(std::uint32_t layer) -> layer_group &;
+	auto update_broadphase() -> void;
+	auto find_collisions_in_cell(const glm::ivec2 &cell, std::span<const entt::entity> entities) -> void;
+	auto find_collisions_between(const glm::ivec2 &cell,
+								 std::span<const entt::entity> entities,
+								 std::span<const entt::entity> others) -> void;
+	auto test_candidates(const glm::ivec2 &cell, entt::entity entity, std::span<const entt::entity> others) -> void;
+	auto find_collisions_of_oversized(entt::entity entity) -> void;
+	// runs the narrow phase of entity against the candidates gathered for it
+	auto test_narrow_phase(entt::entity entity) -> void;
+	auto on_proxy_destroyed(entt::registry &world, entt::entity entity) -> void;
 
-	[[nodiscard]] static auto triangles_intersect(const glm::vec2 &a0,
-												  const glm::vec2 &a1,
-												  const glm::vec2 &a2,
-												  const glm::vec2 &b0,
-												  const glm::vec2 &b1,
-												  const glm::vec2 &b2) noexcept -> bool;
+	auto queue_changes() const -> void;
 
-	[[nodiscard]] static auto overlaps(const bounds &a, const bounds &b) noexcept -> bool;
+	[[nodiscard]] static auto pair_key(const collision &col) noexcept -> std::uint64_t;
+	[[nodiscard]] static auto compatible(const broadphase_proxy &a, const broadphase_proxy &b) noexcept -> bool;
+	[[nodiscard]] static auto aabb_of(const bounds &b) noexcept -> broadphase_proxy;
+	[[nodiscard]] static auto aabb_overlap(const broadphase_proxy &a, const broadphase_proxy &b) noexcept -> bool;
+	[[nodiscard]] static auto is_first_shared_cell(const glm::ivec2 &cell,
+												   const cell_range &a,
+												   const cell_range &b) noexcept -> bool;
 };
 
 } // namespace lge
\ No newline at end of file
@@ -7,49 +7,48 @@
 #include <lge/components/hierarchy.hpp>
 #include <lge/core/result.hpp>
 #include <lge/internal/components/effective_hidden.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <entity/fwd.hpp>
 #include <entt/entt.hpp>
 #include <vector>
 
 namespace lge {
 
+auto hidden_system::access() const -> system_access {
+	return system_access{}.read<hidden, parent, children>().write<effective_hidden>();
+}
+
 auto hidden_system::update(const float /*dt*/) -> result<> {
-	for(const auto entity: ctx.world.view<entt::entity>(entt::exclude<parent>)) {
-		if(ctx.world.any_of<hidden>(entity)) {
-			ctx.world.emplace_or_replace<effective_hidden>(entity);
-		} else {
-			ctx.world.remove<effective_hidden>(entity);
-		}
-		hidden_stack_.push_back(entity);
+	for(const auto entity: ctx.world.view<entt::entity>(entt::exclude<parent, children>)) {
+		apply(entity, ctx.world.any_of<hidden>(entity));
 	}
 
-	while(!hidden_stack_.empty()) {
-		const auto entity = hidden_stack_.back();
-		hidden_stack_.pop_back();
-
-		// if the parent is hidden, all children are hidden, otherwise we need to check each child
-		const bool parent_hidden = ctx.world.any_of<effective_hidden>(entity);
-		if(ctx.world.any_of<children>(entity)) {
-			if(parent_hidden) {
-				for(auto child: ctx.world.get<children>(entity).ids) {
-					ctx.world.emplace_or_replace<effective_hidden>(child);
-					hidden_stack_.push_back(child);
-				}
-			} else {
-				for(auto child: ctx.world.get<children>(entity).ids) {
-					if(ctx.world.any_of<hidden>(child)) {
-						ctx.world.emplace_or_replace<effective_hidden>(child);
-					} else {
-						ctx.world.remove<effective_hidden>(child);
-					}
-					hidden_stack_.push_back(child);
-				}
-			}
-		}
+	const auto &hierarchy = flat_hierarchy::of(ctx.world);
+	const auto entities = hierarchy.entities();
+	const auto parents = hierarchy.parents();
+	nodes_hidden_.resize(entities.size());
+
+	// if the parent is hidden, all children are hidden, otherwise each child decides
+	for(std::size_t i = 0; i < entities.size(); ++i) {
+		const auto parent_index = parents[i];
+		const bool parent_hidden = parent_index != flat_hierarchy::no_parent && nodes_hidden_[parent_index] != 0U;
+		const bool is_hidden = parent_hidden || ctx.world.any_of<hidden>(entities[i]);
+		nodes_hidden_[i] = is_hidden ? 1U : 0U;
+		apply(entities[i], is_hidden);
 	}
 
 	return true;
 }
 
+auto hidden_system::apply(const entt::entity entity, const bool is_hidden) const -> void {
+	if(is_hidden) {
+		ctx.world.emplace_or_replace<effective_hidden>(entity);
+	} else {
+		ctx.world.remove<effective_hidden>(entity);
+	}
+}
+
 } // namespace lge
\ No newline at end of file
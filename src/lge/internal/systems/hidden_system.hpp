@@ -6,6 +6,7 @@
 #include <lge/core/result.hpp>
 #include <lge/systems/system.hpp>
 
+#include <cstdint>
 #include <entity/fwd.hpp>
 #include <vector>
 
@@ -15,9 +16,12 @@ class hidden_system: public system {
 public:
 	using system::system;
 	auto update(float dt) -> result<> override;
+	[[nodiscard]] auto access() const -> system_access override;
 
 private:
-	std::vector<entt::entity> hidden_stack_;
+	std::vector<std::uint8_t> nodes_hidden_;
+
+	auto apply(entt::entity entity, bool is_hidden) const -> void;
 };
 
 } // namespace lge
\ No newline at end of file
@@ -8,19 +8,26 @@
 #include <lge/components/panel.hpp>
 #include <lge/components/shapes.hpp>
 #include <lge/components/sprite.hpp>
+#include <lge/core/log.hpp>
 #include <lge/core/result.hpp>
 #include <lge/interface/renderer.hpp>
+#include <lge/interface/resource_manager.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/components/label_layout.hpp>
 #include <lge/internal/components/metrics.hpp>
 #include <lge/internal/components/previous_button.hpp>
 #include <lge/internal/components/previous_label.hpp>
 #include <lge/internal/components/previous_panel.hpp>
 #include <lge/internal/components/previous_shapes.hpp>
 #include <lge/internal/components/previous_sprite.hpp>
-#include <lge/internal/components/rich_segments.hpp>
-#include <lge/internal/text/rich_text.hpp>
+#include <lge/internal/components/sprite_source.hpp>
+#include <lge/internal/components/text_metrics.hpp>
 
 #include <entity/fwd.hpp>
+#include <entt/core/fwd.hpp>
 #include <entt/entt.hpp>
+#include <functional>
+#include <string>
 
 namespace lge {
 
@@ -76,8 +83,40 @@ auto metrics_system::is_circle_dirty(const circle &c, const previous_circle &p)
 }
 
 auto metrics_system::calculate_sprite_metrics(const entt::entity entity, const sprite &spr) const -> void {
-	const auto frame_size = ctx.render.get_sprite_frame_size(spr.sheet, spr.frame);
-	ctx.world.emplace_or_replace<metrics>(entity, metrics{.size = frame_size});
+	const auto &resolved = resolve_source(entity, spr.sheet, spr.frame);
+	ctx.world.emplace_or_replace<metrics>(entity, metrics{.size = resolved.source_size});
+}
+
+auto metrics_system::is_source_stale(const entt::entity entity,
+									 const sprite_sheet_handle sheet,
+									 const entt::id_type frame) const -> bool {
+	const auto *source = ctx.world.try_get<sprite_source>(entity);
+	return source == nullptr || source->sheet != sheet || source->frame != frame
+		   || source->generation != ctx.resources.texture_generation();
+}
+
+// failures are cached as well, so a missing frame is reported once and not on every frame, a sheet still loading
+// changes the texture generation once it is ready, resolving it again
+auto metrics_system::resolve_source(const entt::entity entity,
+									const sprite_sheet_handle sheet,
+									const entt::id_type frame) const -> const resolved_frame & {
+	resolved_frame resolved{};
+	if(const auto err = ctx.render.resolve_sprite_frame(sheet, frame).unwrap(resolved); err) [[unlikely]] {
+		if(ctx.resources.get_load_state(sheet) != load_state::pending) {
+			log::error("failed to get sprite sheet frame '{}' from sheet {}", frame, sheet);
+		}
+		resolved = {};
+	}
+
+	return ctx.world
+		.emplace_or_replace<sprite_source>(entity,
+										   sprite_source{
+											   .sheet = sheet,
+											   .frame = frame,
+											   .generation = ctx.resources.texture_generation(),
+											   .resolved = resolved,
+										   })
+		.resolved;
 }
 
 auto metrics_system::is_sprite_dirty(const sprite &spr, const previous_sprite &p) -> bool {
@@ -87,7 +126,9 @@ auto metrics_system::is_sprite_dirty(const sprite &spr, const previous_sprite &p
 auto metrics_system::handle_sprites() const -> void {
 	for(const auto entity: ctx.world.view<sprite>()) {
 		auto &p = ctx.world.get_or_emplace<previous_sprite>(entity);
-		if(auto &spr = ctx.world.get<sprite>(entity); !ctx.world.all_of<metrics>(entity) || is_sprite_dirty(spr, p)) {
+		auto &spr = ctx.world.get<sprite>(entity);
+		const auto stale = is_source_stale(entity, spr.sheet, spr.frame);
+		if(!ctx.world.all_of<metrics>(entity) || is_sprite_dirty(spr, p) || stale) {
 			calculate_sprite_metrics(entity, spr);
 			p.sheet = spr.sheet;
 			p.frame = spr.frame;
@@ -103,12 +144,13 @@ auto metrics_system::handle_labels() const -> void {
 		if(!ctx.world.all_of<metrics>(entity) || is_label_dirty(lbl, p)) {
 			calculate_label_metrics(entity, lbl);
 
-			if(has_rich_tags(lbl.text)) {
-				ctx.world.emplace_or_replace<rich_segments>(entity,
-															rich_segments{parse_rich_text(lbl.text, lbl.text_color)});
-			} else {
-				ctx.world.remove<rich_segments>(entity);
-			}
+			const auto size = static_cast<int>(lbl.size);
+			ctx.world.emplace_or_replace<label_layout>(
+				entity,
+				label_layout{
+					.glyphs = ctx.render.layout_label(lbl.font, lbl.text, size, lbl.text_color),
+					.text_hash = std::hash<std::string>{}(lbl.text),
+				});
 
 			p.text = lbl.text;
 			p.size = lbl.size;
@@ -149,10 +191,14 @@ auto metrics_system::is_panel_dirty(const panel &pnl, const previous_panel &p) -
 auto metrics_system::handle_panels() const -> void {
 	for(const auto entity: ctx.world.view<panel>()) {
 		auto &p = ctx.world.get_or_emplace<previous_panel>(entity);
-		if(auto &pnl = ctx.world.get<panel>(entity); !ctx.world.all_of<metrics>(entity) || is_panel_dirty(pnl, p)) {
+		auto &pnl = ctx.world.get<panel>(entity);
+		if(!ctx.world.all_of<metrics>(entity) || is_panel_dirty(pnl, p)) {
 			calculate_panel_metrics(entity, pnl);
 			p.size = pnl.size;
 		}
+		if(is_source_stale(entity, pnl.sheet, pnl.frame)) {
+			resolve_source(entity, pnl.sheet, pnl.frame);
+		}
 	}
 }
 
@@ -160,17 +206,37 @@ auto metrics_system::calculate_button_metrics(const entt::entity entity, const b
 	ctx.world.emplace_or_replace<metrics>(entity, metrics{.size = btn.size});
 }
 
+auto metrics_system::calculate_button_text_metrics(const entt::entity entity, const button &btn) const -> void {
+	const auto text_size = ctx.render.get_label_size(btn.font, btn.text, static_cast<int>(btn.text_size));
+	ctx.world.emplace_or_replace<text_metrics>(
+		entity, text_metrics{.size = text_size, .text_hash = std::hash<std::string>{}(btn.text)});
+}
+
 auto metrics_system::is_button_dirty(const button &btn, const previous_button &p) -> bool {
 	return btn.size != p.size;
 }
 
+auto metrics_system::is_button_text_dirty(const button &btn, const previous_button &p) -> bool {
+	return btn.text != p.text || btn.text_size != p.text_size || btn.font != p.font;
+}
+
 auto metrics_system::handle_buttons() const -> void {
 	for(const auto entity: ctx.world.view<button>()) {
 		auto &p = ctx.world.get_or_emplace<previous_button>(entity);
-		if(auto &btn = ctx.world.get<button>(entity); !ctx.world.all_of<metrics>(entity) || is_button_dirty(btn, p)) {
+		auto &btn = ctx.world.get<button>(entity);
+		if(!ctx.world.all_of<metrics>(entity) || is_button_dirty(btn, p)) {
 			calculate_button_metrics(entity, btn);
 			p.size = btn.size;
 		}
+		if(!ctx.world.all_of<text_metrics>(entity) || is_button_text_dirty(btn, p)) {
+			calculate_button_text_metrics(entity, btn);
+			p.text = btn.text;
+			p.text_size = btn.text_size;
+			p.font = btn.font;
+		}
+		if(is_source_stale(entity, btn.sheet, btn.frame)) {
+			resolve_source(entity, btn.sheet, btn.frame);
+		}
 	}
 }
 
@@ -10,6 +10,7 @@
 #include <lge/components/sprite.hpp>
 #include <lge/core/result.hpp>
 #include <lge/interface/renderer.hpp>
+#include <lge/interface/resources.hpp>
 #include <lge/internal/components/previous_button.hpp>
 #include <lge/internal/components/previous_label.hpp>
 #include <lge/internal/components/previous_panel.hpp>
@@ -18,6 +19,7 @@
 #include <lge/systems/system.hpp>
 
 #include <entity/fwd.hpp>
+#include <entt/core/fwd.hpp>
 
 namespace lge {
 
@@ -33,6 +35,12 @@ private:
 	auto calculate_sprite_metrics(entt::entity entity, const sprite &spr) const -> void;
 	auto calculate_panel_metrics(entt::entity entity, const panel &pnl) const -> void;
 	auto calculate_button_metrics(entt::entity entity, const button &btn) const -> void;
+	auto calculate_button_text_metrics(entt::entity entity, const button &btn) const -> void;
+
+	[[nodiscard]] auto is_source_stale(entt::entity entity, sprite_sheet_handle sheet, entt::id_type frame) const
+		-> bool;
+	auto resolve_source(entt::entity entity, sprite_sheet_handle sheet, entt::id_type frame) const
+		-> const resolved_frame &;
 
 	static auto is_label_dirty(const label &lbl, const previous_label &p) -> bool;
 	static auto is_rect_dirty(const rect &r, const previous_rect &p) -> bool;
@@ -40,6 +48,7 @@ private:
 	static auto is_sprite_dirty(const sprite &spr, const previous_sprite &p) -> bool;
 	static auto is_panel_dirty(const panel &pnl, const previous_panel &p) -> bool;
 	static auto is_button_dirty(const button &btn, const previous_button &p) -> bool;
+	static auto is_button_text_dirty(const button &btn, const previous_button &p) -> bool;
 
 	auto handle_labels() const -> void;
 	auto handle_rects() const -> void;
@@ -7,39 +7,61 @@
 #include <lge/components/order.hpp>
 #include <lge/core/result.hpp>
 #include <lge/internal/components/render_order.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
 
+#include <cstddef>
 #include <entity/fwd.hpp>
 #include <entt/entt.hpp>
 
 namespace lge {
 
+auto order_system::access() const -> system_access {
+	// children without an order get a default one
+	return system_access{}.read<parent, children>().write<order, render_order>();
+}
+
 auto order_system::update(const float /*dt*/) -> result<> {
-	for(const auto entity: ctx.world.view<order>(entt::exclude<parent>)) {
+	for(const auto entity: ctx.world.view<order>(entt::exclude<parent, children>)) {
 		const auto &local = ctx.world.get<order>(entity);
 		ctx.world.emplace_or_replace<render_order>(entity, render_order{.layer = local.layer, .index = local.index});
-		order_stack_.push_back(entity);
 	}
 
-	while(!order_stack_.empty()) {
-		const auto entity = order_stack_.back();
-		order_stack_.pop_back();
-
-		const auto &parent_render_order = ctx.world.get<render_order>(entity);
+	const auto &hierarchy = flat_hierarchy::of(ctx.world);
+	const auto entities = hierarchy.entities();
+	const auto parents = hierarchy.parents();
+	nodes_.resize(entities.size());
 
-		if(ctx.world.any_of<children>(entity)) {
-			for(const auto &kids = ctx.world.get<children>(entity).ids; const auto child: kids) {
-				const auto &local = ctx.world.get_or_emplace<order>(child);
-				const auto child_layer = parent_render_order.layer;
-				const auto child_index = parent_render_order.index + local.index;
-
-				ctx.world.emplace_or_replace<render_order>(child,
-														   render_order{.layer = child_layer, .index = child_index});
-				order_stack_.push_back(child);
-			}
+	for(std::size_t i = 0; i < entities.size(); ++i) {
+		if(const auto parent_index = parents[i]; parent_index == flat_hierarchy::no_parent) {
+			nodes_[i] = update_root(entities[i]);
+		} else {
+			nodes_[i] = update_child(entities[i], nodes_[parent_index]);
 		}
 	}
 
 	return true;
 }
 
+auto order_system::update_root(const entt::entity entity) const -> node_order {
+	const auto *local = ctx.world.try_get<order>(entity);
+	if(local == nullptr) {
+		return node_order{};
+	}
+
+	const auto value = render_order{.layer = local->layer, .index = local->index};
+	ctx.world.emplace_or_replace<render_order>(entity, value);
+	return node_order{.resolved = true, .value = value};
+}
+
+auto order_system::update_child(const entt::entity entity, const node_order &parent_node) const -> node_order {
+	if(!parent_node.resolved) {
+		return node_order{};
+	}
+
+	const auto &local = ctx.world.get_or_emplace<order>(entity);
+	const auto value = render_order{.layer = parent_node.value.layer, .index = parent_node.value.index + local.index};
+	ctx.world.emplace_or_replace<render_order>(entity, value);
+	return node_order{.resolved = true, .value = value};
+}
+
 } // namespace lge
\ No newline at end of file
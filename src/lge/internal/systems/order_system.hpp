@@ -4,6 +4,7 @@
 #pragma once
 
 #include <lge/core/result.hpp>
+#include <lge/internal/components/render_order.hpp>
 #include <lge/systems/system.hpp>
 
 #include <entity/fwd.hpp>
@@ -15,9 +16,18 @@ class order_system: public system {
 public:
 	using system::system;
 	auto update(float dt) -> result<> override;
+	[[nodiscard]] auto access() const -> system_access override;
 
 private:
-	std::vector<entt::entity> order_stack_;
+	struct node_order {
+		bool resolved = false;
+		render_order value;
+	};
+
+	std::vector<node_order> nodes_;
+
+	[[nodiscard]] auto update_root(entt::entity entity) const -> node_order;
+	[[nodiscard]] auto update_child(entt::entity entity, const node_order &parent_node) const -> node_order;
 };
 
 } // namespace lge
\ No newline at end of file
@@ -51,9 +51,7 @@ auto pointer_system::update(const float /*dt*/) -> result<> {
 			// mouse button released while hovered — fire click
 			if(ctx.world.all_of<pressed>(entity)) [[unlikely]] {
 				ctx.world.remove<pressed>(entity);
-				if(const auto err = ctx.events.post(click{.entity = entity}).unwrap(); err) [[unlikely]] {
-					return error("failed to post click event", *err);
-				}
+				ctx.events.enqueue(click{.entity = entity});
 			}
 		}
 	}
@@ -5,37 +5,99 @@
 
 #include <lge/components/button.hpp>
 #include <lge/components/collidable.hpp>
+#include <lge/components/hierarchy.hpp>
 #include <lge/components/hovered.hpp>
 #include <lge/components/label.hpp>
 #include <lge/components/panel.hpp>
 #include <lge/components/placement.hpp>
+#include <lge/components/render_cache.hpp>
 #include <lge/components/shapes.hpp>
 #include <lge/components/sprite.hpp>
 #include <lge/core/colors.hpp>
 #include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/interface/resources.hpp>
 #include <lge/internal/components/bounds.hpp>
 #include <lge/internal/components/effective_hidden.hpp>
+#include <lge/internal/components/label_layout.hpp>
 #include <lge/internal/components/metrics.hpp>
 #include <lge/internal/components/overlapping.hpp>
 #include <lge/internal/components/pressed.hpp>
 #include <lge/internal/components/render_order.hpp>
-#include <lge/internal/components/rich_segments.hpp>
+#include <lge/internal/components/sprite_source.hpp>
+#include <lge/internal/components/text_metrics.hpp>
 #include <lge/internal/components/transform.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
 
 #include <algorithm>
-#include <cmath>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <entity/fwd.hpp>
 #include <entt/entt.hpp>
-#include <glm/ext/matrix_float3x3.hpp>
+#include <functional>
+#include <glm/common.hpp>
 #include <glm/ext/vector_float2.hpp>
-#include <glm/ext/vector_float3.hpp>
-#include <glm/geometric.hpp>
-#include <glm/trigonometric.hpp>
+#include <limits>
+#include <span>
+#include <string>
 
 namespace lge {
 
+namespace {
+
+// transparent border around a cache's texture, so glyph padding and outlines at its edges are not clipped
+constexpr auto cache_padding = 2.0F;
+// the same slack around the area an entity draws in, when telling whether two draws overlap
+constexpr auto draw_padding = cache_padding;
+// positions within a cache closer than this draw the same, so rounding as its root moves does not redraw it
+constexpr auto cache_layout_step = 1.0F / 64.0F;
+constexpr std::uint64_t signature_seed = 0xCBF29CE484222325ULL;
+
+auto hash_value(const std::uint64_t value) -> std::uint64_t {
+	return value;
+}
+
+auto hash_value(const std::uint32_t value) -> std::uint64_t {
+	return value;
+}
+
+auto hash_value(const int value) -> std::uint64_t {
+	return static_cast<std::uint32_t>(value);
+}
+
+auto hash_value(const bool value) -> std::uint64_t {
+	return value ? 1U : 0U;
+}
+
+auto hash_value(const float value) -> std::uint64_t {
+	return std::bit_cast<std::uint32_t>(value);
+}
+
+auto hash_value(const glm::vec2 &value) -> std::uint64_t {
+	return (hash_value(value.x) << 32U) | hash_value(value.y);
+}
+
+auto hash_value(const color &value) -> std::uint64_t {
+	return (std::uint64_t{value.r} << 24U) | (std::uint64_t{value.g} << 16U) | (std::uint64_t{value.b} << 8U)
+		   | value.a;
+}
+
+auto hash_value(const std::string &value) -> std::uint64_t {
+	return std::hash<std::string>{}(value);
+}
+
+template<typename... Values>
+auto mix(std::uint64_t seed, const Values &...values) -> std::uint64_t {
+	((seed ^= hash_value(values) + 0x9E3779B97F4A7C15ULL + (seed << 6U) + (seed >> 2U)), ...);
+	return seed;
+}
+
+} // namespace
+
 auto render_system::update(const float /*dt*/) -> result<> {
 	render_entries_.clear();
+	draw_list_.clear();
 
 	const auto view = ctx.world.view<transform, metrics>(entt::exclude<effective_hidden>);
 	render_entries_.reserve(view.size_hint());
@@ -49,204 +111,507 @@ auto render_system::update(const float /*dt*/) -> result<> {
 		}
 	}
 
+	// draws are recorded in entity order, sorting only batches those sharing a texture where they do not overlap
 	std::ranges::sort(render_entries_);
 
-	for(const auto &[layer, index, entity]: render_entries_) {
-		const auto &world_transform = ctx.world.get<transform>(entity).world;
+	++frame_;
+	find_cache_roots();
+	draw_caches();
+
+	for(const auto &entry: render_entries_) {
+		const auto entity = entry.entity;
+
+		// members of a cached subtree are drawn into its texture, drawn in the place of its first member
+		if(!cache_root_of_.empty()) [[unlikely]] {
+			if(const auto it = cache_root_of_.find(entity); it != cache_root_of_.end()) {
+				if(const auto &state = caches_.at(it->second); state.first == entity) {
+					const auto id = entt::to_integral(it->second);
+					draw_list_.cover(state.origin, state.origin + state.size);
+					draw_list_.add(key_of(entry, id),
+								   cache_draw{.cache = id, .origin = state.origin, .size = state.size});
+				}
+			} else {
+				draw_entity(entry, draw_list_);
+			}
+		} else {
+			draw_entity(entry, draw_list_);
+		}
+
+		// debug bounds follow the entities, they are never cached
+		if(ctx.world.all_of<bounds>(entity) && ctx.render.is_debug_draw()) {
+			handle_bounds(entry, ctx.world.get<transform>(entity));
+		}
+	}
+
+	release_stale_caches();
+
+	draw_list_.sort();
+	ctx.render.submit(draw_list_);
+
+	return true;
+}
+
+auto render_system::draw_entity(const render_entry &entry, draw_list &list) -> void {
+	const auto entity = entry.entity;
+	const auto &world_transform = ctx.world.get<transform>(entity);
+	cover(entity, list);
+
+	if(ctx.world.all_of<label>(entity)) {
+		handle_label(entry, world_transform, list);
+	}
+
+	if(ctx.world.all_of<rect>(entity)) {
+		handle_rect(entry, world_transform, list);
+	}
+
+	if(ctx.world.all_of<circle>(entity)) {
+		handle_circle(entry, world_transform, list);
+	}
+
+	if(ctx.world.all_of<sprite>(entity)) {
+		handle_sprite(entry, world_transform, list);
+	}
+
+	if(ctx.world.all_of<panel>(entity)) {
+		handle_panel(entry, world_transform, list);
+	}
+
+	if(ctx.world.all_of<button>(entity)) {
+		handle_button(entry, world_transform, list);
+	}
+}
+
+// =============================================================================
+// Render caches
+// =============================================================================
+
+// every entity under a render_cache, the outermost one owning nested caches, mapped to that root
+auto render_system::find_cache_roots() -> void {
+	cache_root_of_.clear();
+
+	const auto cached = ctx.world.view<render_cache>();
+	if(cached.empty()) [[likely]] {
+		return;
+	}
+
+	for(const auto entity: cached) {
+		cache_root_of_.emplace(entity, entity);
+	}
 
-		if(ctx.world.all_of<label>(entity)) {
-			handle_label(entity, world_transform);
+	// pre-order, so a parent's owner is known before its children are visited
+	const auto &hierarchy = flat_hierarchy::of(ctx.world);
+	const auto entities = hierarchy.entities();
+	const auto parents = hierarchy.parents();
+	cache_owners_.assign(entities.size(), entt::null);
+
+	for(std::size_t i = 0; i < entities.size(); ++i) {
+		if(const auto up = parents[i]; up != flat_hierarchy::no_parent && cache_owners_[up] != entt::null) {
+			cache_owners_[i] = cache_owners_[up];
+		} else if(ctx.world.all_of<render_cache>(entities[i])) {
+			cache_owners_[i] = entities[i];
 		}
 
-		if(ctx.world.all_of<rect>(entity)) {
-			handle_rect(entity, world_transform);
+		if(cache_owners_[i] != entt::null) {
+			cache_root_of_.insert_or_assign(entities[i], cache_owners_[i]);
 		}
+	}
+}
+
+auto render_system::draw_caches() -> void {
+	cached_entries_.clear();
+	if(cache_root_of_.empty()) [[likely]] {
+		return;
+	}
 
-		if(ctx.world.all_of<circle>(entity)) {
-			handle_circle(entity, world_transform);
+	for(const auto &entry: render_entries_) {
+		if(const auto it = cache_root_of_.find(entry.entity); it != cache_root_of_.end()) {
+			cached_entries_.push_back({.root = it->second, .entry = entry});
 		}
+	}
+
+	// stable, each root keeps its members in draw order
+	std::ranges::stable_sort(cached_entries_, {}, [](const cached_entry &c) -> entt::id_type {
+		return entt::to_integral(c.root);
+	});
 
-		if(ctx.world.all_of<sprite>(entity)) {
-			handle_sprite(entity, world_transform);
+	const auto members = std::span<const cached_entry>{cached_entries_};
+	for(std::size_t begin = 0; begin < members.size();) {
+		auto end = begin + 1;
+		while(end < members.size() && members[end].root == members[begin].root) {
+			++end;
 		}
+		draw_cache(members[begin].root, members.subspan(begin, end - begin));
+		begin = end;
+	}
+}
 
-		if(ctx.world.all_of<panel>(entity)) {
-			handle_panel(entity, world_transform);
+// laid out relative to the root, so moving the whole subtree moves the texture instead of drawing it again
+auto render_system::draw_cache(const entt::entity root, const std::span<const cached_entry> members) -> void {
+	const auto *root_transform = ctx.world.try_get<transform>(root);
+	const auto anchor = root_transform != nullptr ? root_transform->origin : glm::vec2{0.0F, 0.0F};
+
+	auto signature = signature_seed;
+	glm::vec2 low{std::numeric_limits<float>::max()};
+	glm::vec2 high{std::numeric_limits<float>::lowest()};
+
+	for(const auto &member: members) {
+		const auto entity = member.entry.entity;
+		signature = mix(signature, signature_of(member.entry, anchor));
+
+		const auto &world_transform = ctx.world.get<transform>(entity);
+		const auto &size = ctx.world.get<metrics>(entity).size;
+		for(const auto corner: {glm::vec2{0.0F, 0.0F}, glm::vec2{size.x, 0.0F}, glm::vec2{0.0F, size.y}, size}) {
+			const auto local = world_transform.apply(corner) - anchor;
+			low = glm::min(low, local);
+			high = glm::max(high, local);
 		}
+	}
 
-		if(ctx.world.all_of<button>(entity)) {
-			handle_button(entity, world_transform);
+	// whole pixels from the root, so a subtree moved by a fraction of a pixel keeps its texture size
+	const auto offset = glm::floor(low) - cache_padding;
+	const auto size = glm::ceil(high) + cache_padding - offset;
+	const auto id = entt::to_integral(root);
+
+	auto [it, created] = caches_.try_emplace(root);
+	auto &state = it->second;
+	state.frame = frame_;
+	state.first = members.front().entry.entity;
+	state.origin = anchor + offset;
+
+	if(created || state.signature != signature || state.size != size) {
+		cache_list_.clear();
+		for(const auto &member: members) {
+			draw_entity(member.entry, cache_list_);
 		}
+		cache_list_.sort();
+		ctx.render.render_to_cache(id, state.origin, size, cache_list_);
 
-		if(ctx.world.all_of<bounds>(entity) && ctx.render.is_debug_draw()) {
-			handle_bounds(entity, world_transform);
+		state.signature = signature;
+		state.size = size;
+	}
+}
+
+auto render_system::release_stale_caches() -> void {
+	for(auto it = caches_.begin(); it != caches_.end();) {
+		if(it->second.frame != frame_) {
+			ctx.render.release_cache(entt::to_integral(it->first));
+			it = caches_.erase(it);
+		} else {
+			++it;
 		}
 	}
+}
 
-	return true;
+// everything that changes what an entity draws into its cache, placed relative to the anchor of the cache's root,
+// a cache is redrawn when any of its members' signature changes
+auto render_system::signature_of(const render_entry &entry, const glm::vec2 &anchor) const -> std::uint64_t {
+	const auto entity = entry.entity;
+	const auto &world_transform = ctx.world.get<transform>(entity);
+	auto signature = mix(signature_seed,
+						 entt::to_integral(entity),
+						 entry.layer,
+						 entry.index,
+						 glm::round((world_transform.origin - anchor) / cache_layout_step),
+						 world_transform.scale,
+						 world_transform.rotation,
+						 ctx.world.get<metrics>(entity).size);
+
+	if(const auto *plc = ctx.world.try_get<placement>(entity); plc != nullptr) {
+		signature = mix(signature, plc->pivot);
+	}
+
+	// text by the hash metrics_system took when it last changed, not read again every frame
+	if(const auto *lbl = ctx.world.try_get<label>(entity); lbl != nullptr) {
+		const auto *layout = ctx.world.try_get<label_layout>(entity);
+		const auto text = layout != nullptr ? layout->text_hash : hash_value(lbl->text);
+		signature = mix(signature, text, lbl->text_color, lbl->size, lbl->font.raw());
+	}
+
+	if(const auto *r = ctx.world.try_get<rect>(entity); r != nullptr) {
+		signature = mix(signature, r->border_color, r->fill_color, r->border_thickness);
+	}
+
+	if(const auto *c = ctx.world.try_get<circle>(entity); c != nullptr) {
+		signature = mix(signature, c->radius, c->border_color, c->fill_color, c->border_thickness);
+	}
+
+	if(const auto *spr = ctx.world.try_get<sprite>(entity); spr != nullptr) {
+		signature = mix(signature,
+						spr->sheet.raw(),
+						spr->frame.value(),
+						spr->flip_horizontal,
+						spr->flip_vertical,
+						spr->tint,
+						resolved_source_of(entity).texture_id);
+	}
+
+	if(const auto *pnl = ctx.world.try_get<panel>(entity); pnl != nullptr) {
+		signature = mix(signature, pnl->sheet.raw(), pnl->frame.value(), pnl->border, pnl->tint);
+	}
+
+	if(const auto *btn = ctx.world.try_get<button>(entity); btn != nullptr) {
+		signature = mix(signature,
+						btn->sheet.raw(),
+						btn->frame.value(),
+						btn->border,
+						ctx.world.get<text_metrics>(entity).text_hash,
+						btn->text_size,
+						btn->text_color,
+						btn->font.raw(),
+						ctx.world.all_of<hovered>(entity),
+						ctx.world.all_of<pressed>(entity),
+						ctx.actions.is_controller_available());
+	}
+
+	return signature;
+}
+
+auto render_system::key_of(const render_entry &entry, const entt::id_type texture) -> std::uint64_t {
+	return draw_list::make_key(entry.layer, entry.index, texture);
 }
 
-auto render_system::transform_point(const glm::mat3 &m, const glm::vec2 &p) -> glm::vec2 {
-	const glm::vec3 v{p.x, p.y, 1.F};
-	const auto r = m * v;
-	return {r.x, r.y};
+// the screen box of the entity, so sorting knows which draws it may batch past
+auto render_system::cover(const entt::entity entity, draw_list &list) const -> void {
+	const auto &world_transform = ctx.world.get<transform>(entity);
+	const auto &size = ctx.world.get<metrics>(entity).size;
+
+	glm::vec2 low{std::numeric_limits<float>::max()};
+	glm::vec2 high{std::numeric_limits<float>::lowest()};
+	for(const auto corner: {glm::vec2{0.0F, 0.0F}, glm::vec2{size.x, 0.0F}, glm::vec2{0.0F, size.y}, size}) {
+		const auto world = world_transform.apply(corner);
+		low = glm::min(low, world);
+		high = glm::max(high, world);
+	}
+	list.cover(low - draw_padding, high + draw_padding);
 }
 
-auto render_system::get_rotation(const glm::mat3 &m) -> float {
-	// column 0 = rotated + scaled X axis
-	const auto sx = glm::length(glm::vec2{m[0][0], m[1][0]});
-	const auto angle = std::atan2(m[1][0] / sx, m[0][0] / sx);
-	return glm::degrees(angle); // CCW, math standard
+auto render_system::resolved_source_of(const entt::entity entity) const -> resolved_frame {
+	if(const auto *source = ctx.world.try_get<sprite_source>(entity); source != nullptr) [[likely]] {
+		return source->resolved;
+	}
+	return {};
 }
 
-auto render_system::get_scale(const glm::mat3 &m) -> glm::vec2 {
-	const auto sx = glm::length(glm::vec2{m[0][0], m[0][1]});
-	const auto sy = glm::length(glm::vec2{m[1][0], m[1][1]});
-	return {sx, sy};
+// groups by backend texture when resolved, sheets sharing a texture then batch together
+auto render_system::texture_key_of(const resolved_frame &source, const sprite_sheet_handle sheet) -> entt::id_type {
+	return source.texture_id != 0 ? source.texture_id : sheet.raw();
 }
 
-auto render_system::handle_label(const entt::entity entity, const glm::mat3 &world_transform) const -> void {
-	const auto &lbl = ctx.world.get<label>(entity);
-	const auto &m = ctx.world.get<metrics>(entity);
-	const auto &plc = ctx.world.get<placement>(entity);
+auto render_system::handle_label(const render_entry &entry, const transform &world_transform, draw_list &list) -> void {
+	const auto &lbl = ctx.world.get<label>(entry.entity);
+	const auto &m = ctx.world.get<metrics>(entry.entity);
+	const auto &plc = ctx.world.get<placement>(entry.entity);
 
-	const auto pivot_world = transform_point(world_transform, plc.pivot * m.size);
-	const auto rotation = get_rotation(world_transform);
-	const auto world_scale = get_scale(world_transform);
+	const auto pivot_world = world_transform.apply(plc.pivot * m.size);
+	const auto rotation = world_transform.rotation;
+	const auto world_scale = glm::abs(world_transform.scale);
 	const auto final_font_size = lbl.size * world_scale.y;
 	const auto pivot_to_top_left_local = -plc.pivot * m.size * world_scale;
-
-	if(const auto *rs = ctx.world.try_get<rich_segments>(entity); rs != nullptr) [[unlikely]] {
-		ctx.render.render_rich_label(
-			lbl.font, rs->segments, static_cast<int>(final_font_size), pivot_world, pivot_to_top_left_local, rotation);
-	} else [[likely]] {
-		ctx.render.render_label(lbl.font,
-								lbl.text,
-								static_cast<int>(final_font_size),
-								lbl.text_color,
-								pivot_world,
-								pivot_to_top_left_local,
-								rotation);
+	const auto key = key_of(entry, lbl.font.raw());
+
+	// laid out at the label's size, scaled by the world like its metrics are
+	if(const auto *layout = ctx.world.try_get<label_layout>(entry.entity); layout != nullptr) [[likely]] {
+		list.add(key,
+				 glyph_draw{
+					 .layout = &layout->glyphs,
+					 .scale = world_scale.y,
+					 .pivot_position = pivot_world,
+					 .rotated_offset = pivot_to_top_left_local,
+					 .rotation = rotation,
+				 });
+	} else [[unlikely]] {
+		list.add(key,
+				 label_draw{
+					 .font = lbl.font,
+					 .text = &lbl.text,
+					 .size = static_cast<int>(final_font_size),
+					 .text_color = lbl.text_color,
+					 .pivot_position = pivot_world,
+					 .rotated_offset = pivot_to_top_left_local,
+					 .rotation = rotation,
+				 });
 	}
 }
 
-auto render_system::handle_rect(const entt::entity entity, const glm::mat3 &world_transform) const -> void {
-	const auto &r = ctx.world.get<rect>(entity);
-	const auto &m = ctx.world.get<metrics>(entity);
+auto render_system::handle_rect(const render_entry &entry, const transform &world_transform, draw_list &list) -> void {
+	const auto &r = ctx.world.get<rect>(entry.entity);
+	const auto &m = ctx.world.get<metrics>(entry.entity);
 
-	const auto center = transform_point(world_transform, glm::vec2{0.5F, 0.5F} * m.size);
+	const auto center = world_transform.apply(glm::vec2{0.5F, 0.5F} * m.size);
 
-	const auto rotation = get_rotation(world_transform);
-	const auto world_scale = get_scale(world_transform);
+	const auto rotation = world_transform.rotation;
+	const auto world_scale = glm::abs(world_transform.scale);
 	const auto scaled_size = m.size * world_scale;
 	const auto scaled_border_thickness = r.border_thickness * ((world_scale.x + world_scale.y) * 0.5F);
 
-	ctx.render.render_rect(center, scaled_size, rotation, r.border_color, r.fill_color, scaled_border_thickness);
+	list.add(key_of(entry),
+			 rect_draw{
+				 .center = center,
+				 .size = scaled_size,
+				 .rotation = rotation,
+				 .border_color = r.border_color,
+				 .fill_color = r.fill_color,
+				 .border_thickness = scaled_border_thickness,
+			 });
 }
 
-auto render_system::handle_circle(const entt::entity entity, const glm::mat3 &world_transform) const -> void {
-	const auto c = ctx.world.get<circle>(entity);
-	const auto &m = ctx.world.get<metrics>(entity);
-	const auto &plc = ctx.world.get<placement>(entity);
+auto render_system::handle_circle(const render_entry &entry,
+								  const transform &world_transform,
+								  draw_list &list) -> void {
+	const auto c = ctx.world.get<circle>(entry.entity);
+	const auto &m = ctx.world.get<metrics>(entry.entity);
+	const auto &plc = ctx.world.get<placement>(entry.entity);
 
-	const auto center_world = transform_point(world_transform, plc.pivot * m.size);
-	const auto world_scale = get_scale(world_transform);
+	const auto center_world = world_transform.apply(plc.pivot * m.size);
+	const auto world_scale = glm::abs(world_transform.scale);
 	const auto avg_scale = (world_scale.x + world_scale.y) * 0.5F;
 	const auto scaled_radius = c.radius * avg_scale;
 	const auto scaled_border_thickness = c.border_thickness * avg_scale;
 
-	ctx.render.render_circle(center_world, scaled_radius, c.border_color, c.fill_color, scaled_border_thickness);
+	list.add(key_of(entry),
+			 circle_draw{
+				 .center = center_world,
+				 .radius = scaled_radius,
+				 .border_color = c.border_color,
+				 .fill_color = c.fill_color,
+				 .border_thickness = scaled_border_thickness,
+			 });
 }
 
-auto render_system::handle_sprite(const entt::entity entity, const glm::mat3 &world_transform) const -> void {
-	const auto &spr = ctx.world.get<sprite>(entity);
-	const auto &m = ctx.world.get<metrics>(entity);
-	const auto &plc = ctx.world.get<placement>(entity);
+auto render_system::handle_sprite(const render_entry &entry,
+								  const transform &world_transform,
+								  draw_list &list) -> void {
+	const auto &spr = ctx.world.get<sprite>(entry.entity);
+	const auto &m = ctx.world.get<metrics>(entry.entity);
+	const auto &plc = ctx.world.get<placement>(entry.entity);
 
-	const auto pivot_world = transform_point(world_transform, plc.pivot * m.size);
-	const auto rotation = get_rotation(world_transform);
-	const auto world_scale = get_scale(world_transform);
+	const auto pivot_world = world_transform.apply(plc.pivot * m.size);
+	const auto rotation = world_transform.rotation;
+	const auto world_scale = glm::abs(world_transform.scale);
 	const auto scaled_size = m.size * world_scale;
 
-	ctx.render.render_sprite(spr.sheet,
-							 spr.frame,
-							 pivot_world,
-							 scaled_size,
-							 plc.pivot,
-							 rotation,
-							 spr.flip_horizontal,
-							 spr.flip_vertical,
-							 spr.tint);
-}
-
-auto render_system::handle_panel(const entt::entity entity, const glm::mat3 &world_transform) const -> void {
-	const auto &pnl = ctx.world.get<panel>(entity);
-	const auto &m = ctx.world.get<metrics>(entity);
-	const auto &plc = ctx.world.get<placement>(entity);
-
-	const auto pivot_world = transform_point(world_transform, plc.pivot * m.size);
-	const auto rotation = get_rotation(world_transform);
-	const auto world_scale = get_scale(world_transform);
-	const auto scaled_size = m.size * world_scale;
-
-	ctx.render.render_panel(pnl.sheet, pnl.frame, pivot_world, scaled_size, plc.pivot, rotation, pnl.border, pnl.tint);
+	const auto source = resolved_source_of(entry.entity);
+	list.add(key_of(entry, texture_key_of(source, spr.sheet)),
+			 sprite_draw{
+				 .sheet = spr.sheet,
+				 .frame = spr.frame,
+				 .pivot_position = pivot_world,
+				 .size = scaled_size,
+				 .pivot = plc.pivot,
+				 .rotation = rotation,
+				 .flip_horizontal = spr.flip_horizontal,
+				 .flip_vertical = spr.flip_vertical,
+				 .tint = spr.tint,
+				 .source = source,
+			 });
 }
 
-auto render_system::handle_button(const entt::entity entity, const glm::mat3 &world_transform) const -> void {
-	const auto &btn = ctx.world.get<button>(entity);
-	const auto &m = ctx.world.get<metrics>(entity);
-	const auto &plc = ctx.world.get<placement>(entity);
+auto render_system::handle_panel(const render_entry &entry, const transform &world_transform, draw_list &list) -> void {
+	const auto &pnl = ctx.world.get<panel>(entry.entity);
+	const auto &m = ctx.world.get<metrics>(entry.entity);
+	const auto &plc = ctx.world.get<placement>(entry.entity);
 
-	const auto pivot_world = transform_point(world_transform, plc.pivot * m.size);
-	const auto rotation = get_rotation(world_transform);
-	const auto world_scale = get_scale(world_transform);
+	const auto pivot_world = world_transform.apply(plc.pivot * m.size);
+	const auto rotation = world_transform.rotation;
+	const auto world_scale = glm::abs(world_transform.scale);
 	const auto scaled_size = m.size * world_scale;
 
-	const auto tint = ctx.world.all_of<pressed>(entity)	  ? btn.pressed_tint
-					  : ctx.world.all_of<hovered>(entity) ? btn.hover_tint
-														  : btn.normal_tint;
+	const auto source = resolved_source_of(entry.entity);
+	list.add(key_of(entry, texture_key_of(source, pnl.sheet)),
+			 panel_draw{
+				 .sheet = pnl.sheet,
+				 .frame = pnl.frame,
+				 .pivot_position = pivot_world,
+				 .size = scaled_size,
+				 .pivot = plc.pivot,
+				 .rotation = rotation,
+				 .border = pnl.border,
+				 .tint = pnl.tint,
+				 .source = source,
+			 });
+}
 
-	ctx.render.render_panel(btn.sheet, btn.frame, pivot_world, scaled_size, plc.pivot, rotation, btn.border, tint);
+auto render_system::handle_button(const render_entry &entry,
+								  const transform &world_transform,
+								  draw_list &list) -> void {
+	const auto &btn = ctx.world.get<button>(entry.entity);
+	const auto &m = ctx.world.get<metrics>(entry.entity);
+	const auto &plc = ctx.world.get<placement>(entry.entity);
+
+	const auto pivot_world = world_transform.apply(plc.pivot * m.size);
+	const auto rotation = world_transform.rotation;
+	const auto world_scale = glm::abs(world_transform.scale);
+	const auto scaled_size = m.size * world_scale;
 
-	const auto text_size = ctx.render.get_label_size(btn.font, btn.text, static_cast<int>(btn.text_size));
-	const auto center_world = transform_point(world_transform, glm::vec2{0.5F, 0.5F} * m.size);
+	const auto tint = ctx.world.all_of<pressed>(entry.entity)	? btn.pressed_tint
+					  : ctx.world.all_of<hovered>(entry.entity) ? btn.hover_tint
+																: btn.normal_tint;
+
+	const auto source = resolved_source_of(entry.entity);
+	list.add(key_of(entry, texture_key_of(source, btn.sheet)),
+			 panel_draw{
+				 .sheet = btn.sheet,
+				 .frame = btn.frame,
+				 .pivot_position = pivot_world,
+				 .size = scaled_size,
+				 .pivot = plc.pivot,
+				 .rotation = rotation,
+				 .border = btn.border,
+				 .tint = tint,
+				 .source = source,
+			 });
+
+	const auto &text_size = ctx.world.get<text_metrics>(entry.entity).size;
+	const auto center_world = world_transform.apply(glm::vec2{0.5F, 0.5F} * m.size);
 	const auto final_font_size = btn.text_size * world_scale.y;
 	const auto pivot_to_top_left = -glm::vec2{0.5F, 0.5F} * text_size * world_scale;
 
-	ctx.render.render_label(btn.font,
-							btn.text,
-							static_cast<int>(final_font_size),
-							btn.text_color,
-							center_world,
-							pivot_to_top_left,
-							rotation);
+	list.add(key_of(entry, btn.font.raw()),
+			 label_draw{
+				 .font = btn.font,
+				 .text = &btn.text,
+				 .size = static_cast<int>(final_font_size),
+				 .text_color = btn.text_color,
+				 .pivot_position = center_world,
+				 .rotated_offset = pivot_to_top_left,
+				 .rotation = rotation,
+			 });
 
 	// Controller overlay — only when controller is active and overlay is defined
 	if(ctx.actions.is_controller_available() && btn.overlay_sheet.is_valid() && btn.overlay_frame != ""_hs) {
 		const auto frame_size = ctx.render.get_sprite_frame_size(btn.overlay_sheet, btn.overlay_frame);
 		const auto scaled_frame = frame_size * world_scale;
 		// Bottom-center of the button in world space
-		const auto bottom_center = transform_point(world_transform, glm::vec2{0.5F, 1.0F} * m.size);
-		ctx.render.render_sprite(btn.overlay_sheet,
-								 btn.overlay_frame,
-								 bottom_center,
-								 scaled_frame,
-								 pivot::center,
-								 rotation,
-								 false,
-								 false,
-								 colors::white);
+		const auto bottom_center = world_transform.apply(glm::vec2{0.5F, 1.0F} * m.size);
+		// hangs below the button, so it covers more than the button's own box
+		const auto reach = glm::vec2{scaled_frame.x + scaled_frame.y};
+		list.cover(bottom_center - reach, bottom_center + reach);
+		list.add(key_of(entry, btn.overlay_sheet.raw()),
+				 sprite_draw{
+					 .sheet = btn.overlay_sheet,
+					 .frame = btn.overlay_frame,
+					 .pivot_position = bottom_center,
+					 .size = scaled_frame,
+					 .pivot = pivot::center,
+					 .rotation = rotation,
+					 .flip_horizontal = false,
+					 .flip_vertical = false,
+					 .tint = colors::white,
+					 .source = {},
+				 });
 	}
 }
 
-auto render_system::handle_bounds(const entt::entity entity, const glm::mat3 & /*world_transform*/) const -> void {
-	const auto &[p0, p1, p2, p3] = ctx.world.get<bounds>(entity);
+auto render_system::handle_bounds(const render_entry &entry, const transform & /*world_transform*/) -> void {
+	const auto &[p0, p1, p2, p3] = ctx.world.get<bounds>(entry.entity);
 
 	color quad_color = bounds_color;
-	if(ctx.world.all_of<collidable>(entity)) {
-		quad_color = ctx.world.all_of<overlapping>(entity) ? overlap_color : collidable_color;
+	if(ctx.world.all_of<collidable>(entry.entity)) {
+		quad_color = ctx.world.all_of<overlapping>(entry.entity) ? overlap_color : collidable_color;
 	}
-	ctx.render.render_quad(p0, p1, p2, p3, quad_color);
+	draw_list_.cover(glm::min(glm::min(p0, p1), glm::min(p2, p3)), glm::max(glm::max(p0, p1), glm::max(p2, p3)));
+	draw_list_.add(key_of(entry),
+				   quad_draw{.p0 = p0, .p1 = p1, .p2 = p2, .p3 = p3, .quad_color = quad_color});
 }
 
 } // namespace lge
\ No newline at end of file
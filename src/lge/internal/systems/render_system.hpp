@@ -5,13 +5,19 @@
 
 #include <lge/core/colors.hpp>
 #include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
 #include <lge/interface/renderer.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/components/transform.hpp>
 #include <lge/systems/system.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <entity/fwd.hpp>
 #include <entt/entt.hpp>
-#include <glm/ext/matrix_float3x3.hpp>
 #include <glm/ext/vector_float2.hpp>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 namespace lge {
@@ -32,19 +38,50 @@ private:
 		auto operator<=>(const render_entry &) const = default;
 	};
 
+	// an entity drawn into the cache of the render_cache root above it instead of into the frame
+	struct cached_entry {
+		entt::entity root;
+		render_entry entry;
+	};
+
+	struct cache_state {
+		std::uint64_t signature; // of everything drawn into the texture, redrawn when it changes
+		glm::vec2 origin;		 // world position of the texture's top left corner this frame
+		glm::vec2 size;
+		std::size_t frame;	// caches not drawn in a frame are released
+		entt::entity first; // the texture is drawn where this member would be
+	};
+
 	std::vector<render_entry> render_entries_;
+	draw_list draw_list_;
+
+	std::unordered_map<entt::entity, entt::entity> cache_root_of_;
+	std::vector<entt::entity> cache_owners_; // per flattened hierarchy entity, while finding roots
+	std::vector<cached_entry> cached_entries_;
+	std::unordered_map<entt::entity, cache_state> caches_;
+	draw_list cache_list_;
+	std::size_t frame_ = 0;
+
+	[[nodiscard]] static auto key_of(const render_entry &entry, entt::id_type texture = 0) -> std::uint64_t;
+	auto cover(entt::entity entity, draw_list &list) const -> void;
+
+	[[nodiscard]] auto resolved_source_of(entt::entity entity) const -> resolved_frame;
+	[[nodiscard]] static auto texture_key_of(const resolved_frame &source, sprite_sheet_handle sheet) -> entt::id_type;
+
+	auto draw_entity(const render_entry &entry, draw_list &list) -> void;
+	auto handle_label(const render_entry &entry, const transform &world_transform, draw_list &list) -> void;
+	auto handle_rect(const render_entry &entry, const transform &world_transform, draw_list &list) -> void;
+	auto handle_circle(const render_entry &entry, const transform &world_transform, draw_list &list) -> void;
+	auto handle_sprite(const render_entry &entry, const transform &world_transform, draw_list &list) -> void;
+	auto handle_panel(const render_entry &entry, const transform &world_transform, draw_list &list) -> void;
+	auto handle_button(const render_entry &entry, const transform &world_transform, draw_list &list) -> void;
+	auto handle_bounds(const render_entry &entry, const transform &world_transform) -> void;
 
-	static auto transform_point(const glm::mat3 &m, const glm::vec2 &p) -> glm::vec2;
-	static auto get_rotation(const glm::mat3 &m) -> float;
-	static auto get_scale(const glm::mat3 &m) -> glm::vec2;
-
-	auto handle_label(entt::entity entity, const glm::mat3 &world_transform) const -> void;
-	auto handle_rect(entt::entity entity, const glm::mat3 &world_transform) const -> void;
-	auto handle_circle(entt::entity entity, const glm::mat3 &world_transform) const -> void;
-	auto handle_sprite(entt::entity entity, const glm::mat3 &world_transform) const -> void;
-	auto handle_panel(entt::entity entity, const glm::mat3 &world_transform) const -> void;
-	auto handle_button(entt::entity entity, const glm::mat3 &world_transform) const -> void;
-	auto handle_bounds(entt::entity entity, const glm::mat3 &world_transform) const -> void;
+	auto find_cache_roots() -> void;
+	auto draw_caches() -> void;
+	auto draw_cache(entt::entity root, std::span<const cached_entry> members) -> void;
+	auto release_stale_caches() -> void;
+	[[nodiscard]] auto signature_of(const render_entry &entry, const glm::vec2 &anchor) const -> std::uint64_t;
 
 	static constexpr auto bounds_color = color::from_hex(0xFF00007F);	  // Red with 50% opacity
 	static constexpr auto overlap_color = color::from_hex(0x00FF007F);	  // Green with 50% opacity
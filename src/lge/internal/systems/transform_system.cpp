@@ -8,14 +8,18 @@
 #include <lge/components/placement.hpp>
 #include <lge/core/result.hpp>
 #include <lge/internal/components/metrics.hpp>
+#include <lge/internal/components/previous_placement.hpp>
 #include <lge/internal/components/transform.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
+#include <lge/internal/scheduler/thread_pool.hpp>
 #include <lge/systems/system.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <entity/fwd.hpp>
-#include <glm/ext/matrix_float3x3.hpp>
 #include <glm/ext/vector_float2.hpp>
-#include <glm/geometric.hpp>
 #include <glm/trigonometric.hpp>
+#include <span>
 #include <vector>
 
 namespace lge {
@@ -25,97 +29,242 @@ transform_system::transform_system(const phase p, context &ctx): system(p, ctx)
 	ctx.world.on_destroy<children>().connect<&transform_system::on_parent_children_cleared>(this);
 }
 
-auto transform_system::compose_transform(const placement &node_placement, const glm::vec2 &pivot_offset) -> glm::mat3 {
-	static constexpr auto x = glm::vec3{1.F, 0.F, 0.F};
-	static constexpr auto y = glm::vec3{0.F, 1.F, 0.F};
-	static constexpr auto z = glm::vec3{0.F, 0.F, 1.F};
+auto transform_system::access() const -> system_access {
+	return system_access{}.read<placement, parent, children, metrics>().write<transform, previous_placement>();
+}
 
+auto transform_system::compose_transform(const placement &node_placement, const glm::vec2 &pivot_offset) -> transform {
 	const float rad = glm::radians(node_placement.rotation);
-	const float s = glm::sin(rad);
-	const float c = glm::cos(rad);
-
-	const auto rotation_scale = glm::mat3{{c * node_placement.scale.x, -s * node_placement.scale.y, 0.F},
-										  {s * node_placement.scale.x, c * node_placement.scale.y, 0.F},
-										  z};
 
-	const auto to_pivot = glm::mat3{x, y, {-pivot_offset.x, -pivot_offset.y, 1.F}};
-	const auto translation = glm::mat3{x, y, {node_placement.position.x, node_placement.position.y, 1.F}};
+	auto world = transform{
+		.origin = {0.F, 0.F},
+		.scale = node_placement.scale,
+		.rotation = node_placement.rotation,
+		.sin = glm::sin(rad),
+		.cos = glm::cos(rad),
+	};
 
-	return translation * rotation_scale * to_pivot;
+	// the pivot lands on the placement position
+	world.origin = node_placement.position - world.apply(pivot_offset);
+	return world;
 }
 
 auto transform_system::update(const float /*dt*/) -> result<> {
-	for(const auto entity: ctx.world.view<placement>(entt::exclude<parent>)) {
-		const auto &local = ctx.world.get<placement>(entity);
-		const auto pivot_offset =
-			ctx.world.all_of<metrics>(entity) ? local.pivot * ctx.world.get<metrics>(entity).size : glm::vec2{0.F, 0.F};
-		const auto world_mat = compose_transform(local, pivot_offset);
-		ctx.world.emplace_or_replace<transform>(entity, transform{.world = world_mat});
-		transform_stack_.push_back(entity);
+	const auto &hierarchy = flat_hierarchy::of(ctx.world);
+	nodes_.resize(hierarchy.size());
+
+	const auto loose = ctx.world.view<placement>(entt::exclude<parent, children>);
+	if(auto *pool = ctx.world.ctx().find<thread_pool>();
+	   pool != nullptr && pool->workers() != 0 && loose.size_hint() + hierarchy.size() >= parallel_threshold) {
+		update_parallel(hierarchy, *pool);
+		return true;
+	}
+
+	for(const auto entity: loose) {
+		update_root(entity, nullptr);
+	}
+	update_range(hierarchy, 0, hierarchy.size(), nullptr);
+
+	return true;
+}
+
+auto transform_system::update_parallel(const flat_hierarchy &hierarchy, thread_pool &pool) -> void {
+	loose_.clear();
+	for(const auto entity: ctx.world.view<placement>(entt::exclude<parent, children>)) {
+		loose_.push_back(entity);
+	}
+
+	split(hierarchy, pool.workers() + 1);
+	deferred_.resize(chunks_.size());
+	for(auto &deferred: deferred_) {
+		deferred.transforms.clear();
+		deferred.previous.clear();
+	}
+
+	// only existing components are written in place, nothing is added or removed while chunks run
+	pool.run(chunks_.size(), [this, &hierarchy](const std::size_t index) -> void {
+		const auto &work = chunks_[index];
+		auto &deferred = deferred_[index];
+		for(const auto entity: work.loose) {
+			update_root(entity, &deferred);
+		}
+		update_range(hierarchy, work.begin, work.end, &deferred);
+	});
+
+	// in chunk order, so each storage gets its new components in the order a serial update adds them
+	for(const auto &deferred: deferred_) {
+		for(const auto &[entity, previous]: deferred.previous) {
+			ctx.world.emplace<previous_placement>(entity, previous);
+		}
+		for(const auto &[entity, world]: deferred.transforms) {
+			ctx.world.emplace<transform>(entity, world);
+		}
+	}
+}
+
+auto transform_system::split(const flat_hierarchy &hierarchy, const std::size_t threads) -> void {
+	chunks_.clear();
+	const auto total = loose_.size() + hierarchy.size();
+	const auto target = std::max<std::size_t>(total / (threads * chunks_per_thread), 1);
+
+	const auto loose = std::span<const entt::entity>{loose_};
+	for(std::size_t begin = 0; begin < loose.size(); begin += target) {
+		chunks_.push_back({.loose = loose.subspan(begin, std::min(target, loose.size() - begin))});
+	}
+
+	// cut only before a root, so a subtree is never split and parents are always updated before their children
+	const auto parents = hierarchy.parents();
+	std::size_t begin = 0;
+	for(std::size_t i = 1; i < parents.size(); ++i) {
+		if(parents[i] == flat_hierarchy::no_parent && i - begin >= target) {
+			chunks_.push_back({.begin = begin, .end = i});
+			begin = i;
+		}
+	}
+	if(begin < parents.size()) {
+		chunks_.push_back({.begin = begin, .end = parents.size()});
+	}
+}
+
+auto transform_system::update_range(const flat_hierarchy &hierarchy,
+									const std::size_t begin,
+									const std::size_t end,
+									deferred_writes *deferred) -> void {
+	const auto entities = hierarchy.entities();
+	const auto parents = hierarchy.parents();
+
+	for(auto i = begin; i < end; ++i) {
+		if(const auto parent_index = parents[i]; parent_index == flat_hierarchy::no_parent) {
+			nodes_[i] = update_root(entities[i], deferred);
+		} else {
+			nodes_[i] = update_child(entities[i], entities[parent_index], nodes_[parent_index], deferred);
+		}
+	}
+}
+
+auto transform_system::update_root(const entt::entity entity, deferred_writes *deferred) -> node_state {
+	const auto *local = ctx.world.try_get<placement>(entity);
+	if(local == nullptr) {
+		return node_state{};
+	}
+
+	const auto pivot_offset = pivot_offset_of(entity, *local);
+	const auto dirty = refresh_previous(entity, *local, pivot_offset, entt::null, deferred);
+	auto node = node_state{.resolved = true, .dirty = dirty, .has_world = dirty, .pivot_offset = pivot_offset};
+	if(dirty) {
+		node.world = compose_transform(*local, pivot_offset);
+		store_transform(entity, node.world, deferred);
 	}
 
-	while(!transform_stack_.empty()) {
-		const auto entity = transform_stack_.back();
-		transform_stack_.pop_back();
+	return node;
+}
+
+auto transform_system::update_child(const entt::entity entity,
+									const entt::entity parent_entity,
+									node_state &parent_node,
+									deferred_writes *deferred) -> node_state {
+	const auto *local = ctx.world.try_get<placement>(entity);
+	if(!parent_node.resolved || local == nullptr) {
+		return node_state{};
+	}
 
-		if(!ctx.world.any_of<children>(entity)) {
-			continue;
+	const auto pivot_offset = pivot_offset_of(entity, *local);
+	const auto dirty = refresh_previous(entity, *local, pivot_offset, parent_entity, deferred) || parent_node.dirty;
+	auto node = node_state{.resolved = true, .dirty = dirty, .has_world = dirty, .pivot_offset = pivot_offset};
+	if(dirty) {
+		// an unchanged parent was not recomposed this frame, so its transform is fetched once for all its children
+		if(!parent_node.has_world) {
+			parent_node.world = ctx.world.get<transform>(parent_entity);
+			parent_node.has_world = true;
 		}
+		node.world = compose_child_transform(parent_node.world, parent_node.pivot_offset, *local, pivot_offset);
+		store_transform(entity, node.world, deferred);
+	}
+
+	return node;
+}
 
-		const auto parent_world = ctx.world.get<transform>(entity).world;
-		const auto &parent_placement = ctx.world.get<placement>(entity);
-		const auto parent_pivot_offset = ctx.world.all_of<metrics>(entity)
-											 ? parent_placement.pivot * ctx.world.get<metrics>(entity).size
+auto transform_system::pivot_offset_of(const entt::entity entity, const placement &local) const -> glm::vec2 {
+	return ctx.world.all_of<metrics>(entity) ? local.pivot * ctx.world.get<metrics>(entity).size
 											 : glm::vec2{0.F, 0.F};
+}
 
-		// The parent's logical position in world space — children position relative to this.
-		const auto pv = parent_world * glm::vec3{parent_pivot_offset.x, parent_pivot_offset.y, 1.F};
-		const auto parent_pos = glm::vec2{pv.x, pv.y};
-
-		for(const auto &kids = ctx.world.get<children>(entity).ids; const auto child: kids) {
-			const auto &local = ctx.world.get<placement>(child);
-			const auto child_pivot_offset = ctx.world.all_of<metrics>(child)
-												? local.pivot * ctx.world.get<metrics>(child).size
-												: glm::vec2{0.F, 0.F};
-
-			// Extract accumulated rotation from parent world matrix
-			const float parent_rad = -glm::atan(parent_world[0][1], parent_world[0][0]);
-			const float ps = glm::sin(parent_rad);
-			const float pc = glm::cos(parent_rad);
-
-			// Parent scale from world matrix column lengths
-			const auto parent_scale = glm::vec2{glm::length(glm::vec2{parent_world[0][0], parent_world[0][1]}),
-												glm::length(glm::vec2{parent_world[1][0], parent_world[1][1]})};
-
-			// Child pivot in world space: scale local position by parent scale, then rotate
-			const auto scaled_pos = local.position * parent_scale;
-			const auto child_pivot_world =
-				parent_pos
-				+ glm::vec2{(pc * scaled_pos.x) - (ps * scaled_pos.y), (ps * scaled_pos.x) + (pc * scaled_pos.y)};
-
-			// Combined rotation and scale for child
-			const float combined_rad = parent_rad + glm::radians(local.rotation);
-			const float s = glm::sin(combined_rad);
-			const float c = glm::cos(combined_rad);
-			const auto child_scale = parent_scale * local.scale;
-
-			// Render pos = child pivot world - RS * child_pivot_offset
-			const auto render_pos =
-				child_pivot_world
-				- glm::vec2{(c * child_scale.x * child_pivot_offset.x) + (s * child_scale.y * child_pivot_offset.y),
-							-(s * child_scale.x * child_pivot_offset.x) + (c * child_scale.y * child_pivot_offset.y)};
-
-			const auto child_world_mat = glm::mat3{glm::vec3{c * child_scale.x, -s * child_scale.y, 0.F},
-												   glm::vec3{s * child_scale.x, c * child_scale.y, 0.F},
-												   glm::vec3{render_pos, 1.F}};
-			ctx.world.emplace_or_replace<transform>(child, transform{.world = child_world_mat});
-			transform_stack_.push_back(child);
+// records the inputs of this frame and reports whether they differ from the ones the transform was built from
+auto transform_system::refresh_previous(const entt::entity entity,
+										const placement &local,
+										const glm::vec2 &pivot_offset,
+										const entt::entity parent_id,
+										deferred_writes *deferred) const -> bool {
+	auto *previous = ctx.world.try_get<previous_placement>(entity);
+	if(previous == nullptr) {
+		if(deferred != nullptr) {
+			deferred->previous.emplace_back(
+				entity, previous_placement{.local = local, .pivot_offset = pivot_offset, .parent_id = parent_id});
+		} else {
+			ctx.world.emplace<previous_placement>(entity, local, pivot_offset, parent_id);
 		}
+		return true;
+	}
+
+	if(!is_placement_dirty(local, pivot_offset, parent_id, *previous)) [[likely]] {
+		return false;
 	}
 
+	*previous = previous_placement{.local = local, .pivot_offset = pivot_offset, .parent_id = parent_id};
 	return true;
 }
 
+// with deferred writes, only a transform the entity already has is replaced now
+auto transform_system::store_transform(const entt::entity entity,
+									   const transform &world,
+									   deferred_writes *deferred) const -> void {
+	if(deferred == nullptr) {
+		ctx.world.emplace_or_replace<transform>(entity, world);
+	} else if(auto *current = ctx.world.try_get<transform>(entity); current != nullptr) [[likely]] {
+		*current = world;
+	} else {
+		deferred->transforms.emplace_back(entity, world);
+	}
+}
+
+auto transform_system::is_placement_dirty(const placement &local,
+										  const glm::vec2 &pivot_offset,
+										  const entt::entity parent_id,
+										  const previous_placement &p) -> bool {
+	return local.position != p.local.position || local.rotation != p.local.rotation || local.scale != p.local.scale
+		   || pivot_offset != p.pivot_offset || parent_id != p.parent_id;
+}
+
+auto transform_system::compose_child_transform(const transform &parent_world,
+											   const glm::vec2 &parent_pivot_offset,
+											   const placement &local,
+											   const glm::vec2 &pivot_offset) -> transform {
+	// The parent's logical position in world space — children position relative to this.
+	const auto parent_pos = parent_world.apply(parent_pivot_offset);
+
+	// Child pivot in world space: scale local position by parent scale, then rotate
+	const auto scaled_pos = local.position * parent_world.scale;
+	const auto child_pivot_world =
+		parent_pos
+		+ glm::vec2{(parent_world.cos * scaled_pos.x) - (parent_world.sin * scaled_pos.y),
+					(parent_world.sin * scaled_pos.x) + (parent_world.cos * scaled_pos.y)};
+
+	// Combined rotation and scale for child
+	const float rotation = parent_world.rotation + local.rotation;
+	const float rad = glm::radians(rotation);
+
+	auto world = transform{
+		.origin = {0.F, 0.F},
+		.scale = parent_world.scale * local.scale,
+		.rotation = rotation,
+		.sin = glm::sin(rad),
+		.cos = glm::cos(rad),
+	};
+
+	world.origin = child_pivot_world - world.apply(pivot_offset);
+	return world;
+}
+
 auto transform_system::on_child_detached(entt::registry &, const entt::entity child) -> void {
 	if(const entt::entity p = ctx.world.get<parent>(child).id; ctx.world.all_of<children>(p)) {
 		auto &kids = ctx.world.get<children>(p).ids;
@@ -6,11 +6,17 @@
 #include <lge/app/context.hpp>
 #include <lge/components/placement.hpp>
 #include <lge/core/result.hpp>
+#include <lge/internal/components/previous_placement.hpp>
+#include <lge/internal/components/transform.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
+#include <lge/internal/scheduler/thread_pool.hpp>
 #include <lge/systems/system.hpp>
 
+#include <cstddef>
 #include <entity/fwd.hpp>
-#include <glm/ext/matrix_float3x3.hpp>
 #include <glm/ext/vector_float2.hpp>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace lge {
@@ -18,11 +24,70 @@ namespace lge {
 class transform_system: public system {
 public:
 	explicit transform_system(phase p, context &ctx);
-	static auto compose_transform(const placement &node_placement, const glm::vec2 &pivot_offset) -> glm::mat3;
+	static auto compose_transform(const placement &node_placement, const glm::vec2 &pivot_offset) -> transform;
 	auto update(float dt) -> result<> override;
+	[[nodiscard]] auto access() const -> system_access override;
 
 private:
-	std::vector<entt::entity> transform_stack_;
+	struct node_state {
+		bool resolved = false;
+		bool dirty = false;
+		bool has_world = false;
+		transform world{};
+		glm::vec2 pivot_offset{};
+	};
+
+	// components a parallel update would create, added one after the other once it is over
+	struct deferred_writes {
+		std::vector<std::pair<entt::entity, transform>> transforms;
+		std::vector<std::pair<entt::entity, previous_placement>> previous;
+	};
+
+	// entities outside the hierarchy, or whole root subtrees of it, updated by one thread
+	struct chunk {
+		std::span<const entt::entity> loose;
+		std::size_t begin = 0;
+		std::size_t end = 0;
+	};
+
+	// below this many entities splitting the work costs more than it saves
+	static constexpr std::size_t parallel_threshold = 4096;
+	// more chunks than threads, so a thread that finishes early steals from a busy one
+	static constexpr std::size_t chunks_per_thread = 4;
+
+	std::vector<node_state> nodes_;
+	std::vector<entt::entity> loose_;
+	std::vector<chunk> chunks_;
+	std::vector<deferred_writes> deferred_;
+
+	auto update_parallel(const flat_hierarchy &hierarchy, thread_pool &pool) -> void;
+	auto split(const flat_hierarchy &hierarchy, std::size_t threads) -> void;
+	auto update_range(const flat_hierarchy &hierarchy, std::size_t begin, std::size_t end, deferred_writes *deferred)
+		-> void;
+
+	auto update_root(entt::entity entity, deferred_writes *deferred) -> node_state;
+	auto update_child(entt::entity entity,
+					  entt::entity parent_entity,
+					  node_state &parent_node,
+					  deferred_writes *deferred) -> node_state;
+
+	[[nodiscard]] auto pivot_offset_of(entt::entity entity, const placement &local) const -> glm::vec2;
+	[[nodiscard]] auto refresh_previous(entt::entity entity,
+										const placement &local,
+										const glm::vec2 &pivot_offset,
+										entt::entity parent_id,
+										deferred_writes *deferred) const -> bool;
+	auto store_transform(entt::entity entity, const transform &world, deferred_writes *deferred) const -> void;
+
+	[[nodiscard]] static auto is_placement_dirty(const placement &local,
+												 const glm::vec2 &pivot_offset,
+												 entt::entity parent_id,
+												 const previous_placement &p) -> bool;
+	[[nodiscard]] static auto compose_child_transform(const transform &parent_world,
+													  const glm::vec2 &parent_pivot_offset,
+													  const placement &local,
+													  const glm::vec2 &pivot_offset) -> transform;
+
 	auto on_child_detached(entt::registry &world, entt::entity child) -> void;
 	auto on_parent_children_cleared(entt::registry &world, entt::entity parent) -> void;
 };
@@ -91,65 +91,58 @@ constexpr auto tag_reset_len = 3; // {#}
 // Public API
 // =============================================================================
 
+auto find_rich_tag(const std::string_view text,
+				   const std::size_t from,
+				   const color &default_color,
+				   rich_tag &tag) noexcept -> bool {
+	// jumps from brace to brace, text between tags is never looked at
+	for(auto pos = text.find(tag_open, from); pos != std::string_view::npos; pos = text.find(tag_open, pos + 1)) {
+		if(try_parse_tag(text, pos, default_color, tag.tag_color, tag.end)) {
+			tag.begin = pos;
+			return true;
+		}
+	}
+	return false;
+}
+
 auto parse_rich_text(const std::string_view text, const color &default_color) -> std::vector<text_segment> {
 	std::vector<text_segment> segments;
+	parse_rich_text(text, default_color, segments);
+	return segments;
+}
 
-	if(text.empty()) [[unlikely]] {
-		return segments;
-	}
+auto parse_rich_text(const std::string_view text, const color &default_color, std::vector<text_segment> &segments)
+	-> void {
+	segments.clear();
 
 	auto current_color = default_color;
-	std::string current_text;
-	current_text.reserve(text.size());
-
-	std::size_t i = 0;
-	while(i < text.size()) {
-		if(text[i] == tag_open) [[unlikely]] {
-			color next_color{};
-			std::size_t tag_end = 0;
-
-			if(try_parse_tag(text, i, default_color, next_color, tag_end)) {
-				// flush current segment before switching color
-				if(!current_text.empty()) {
-					segments.push_back({std::move(current_text), current_color});
-					current_text.clear();
-					current_text.reserve(text.size() - tag_end);
-				}
-				current_color = next_color;
-				i = tag_end;
-				continue;
-			}
-		}
+	std::size_t start = 0;
+	rich_tag tag{};
 
-		current_text += text[i];
-		++i;
+	// malformed tags are not found, so they stay inside the segment around them as literal text
+	while(find_rich_tag(text, start, default_color, tag)) {
+		if(tag.begin != start) {
+			segments.push_back({.offset = start, .length = tag.begin - start, .segment_color = current_color});
+		}
+		current_color = tag.tag_color;
+		start = tag.end;
 	}
 
-	if(!current_text.empty()) {
-		segments.push_back({std::move(current_text), current_color});
+	if(start < text.size()) {
+		segments.push_back({.offset = start, .length = text.size() - start, .segment_color = current_color});
 	}
+}
 
-	return segments;
+auto stripped_length(const std::string_view text) noexcept -> std::size_t {
+	std::size_t length = 0;
+	for_each_plain_run(text, [&length](const std::string_view run) -> void { length += run.size(); });
+	return length;
 }
 
 auto strip_rich_tags(const std::string_view text) -> std::string {
 	std::string result;
-	result.reserve(text.size());
-
-	std::size_t i = 0;
-	while(i < text.size()) {
-		if(text[i] == tag_open) [[unlikely]] {
-			color dummy{};
-			std::size_t tag_end = 0;
-			if(try_parse_tag(text, i, colors::white, dummy, tag_end)) {
-				i = tag_end;
-				continue;
-			}
-		}
-		result += text[i];
-		++i;
-	}
-
+	result.reserve(stripped_length(text));
+	for_each_plain_run(text, [&result](const std::string_view run) -> void { result.append(run); });
 	return result;
 }
 
@@ -161,4 +154,4 @@ auto has_rich_tags(const std::string_view text) noexcept -> bool {
 	return pos + 1 < text.size() && text[pos + 1] == tag_prefix;
 }
 
-} // namespace lge
\ No newline at end of file
+} // namespace lge
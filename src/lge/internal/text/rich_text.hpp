@@ -6,6 +6,7 @@
 #include <lge/core/colors.hpp>
 #include <lge/text/text_segment.hpp>
 
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -22,12 +23,48 @@ namespace lge {
 //
 // Malformed tags (wrong length, invalid hex) are treated as literal text.
 // There is no nesting — {#} always resets to default_color, not a previous color.
+//
+// Segments and runs are views into the parsed text, nothing is copied.
 // =============================================================================
 
+struct rich_tag {
+	std::size_t begin; // of the opening '{'
+	std::size_t end;   // past the closing '}'
+	color tag_color;
+};
+
+// the first well formed tag at or after from
+[[nodiscard]] auto find_rich_tag(std::string_view text,
+								 std::size_t from,
+								 const color &default_color,
+								 rich_tag &tag) noexcept -> bool;
+
 [[nodiscard]] auto parse_rich_text(std::string_view text, const color &default_color) -> std::vector<text_segment>;
 
+// same as above, reusing the storage of segments
+auto parse_rich_text(std::string_view text, const color &default_color, std::vector<text_segment> &segments) -> void;
+
+// calls run(std::string_view) for every non empty run of text between tags, in order
+template<typename Run>
+auto for_each_plain_run(const std::string_view text, Run &&run) -> void {
+	std::size_t from = 0;
+	rich_tag tag{};
+	while(find_rich_tag(text, from, colors::white, tag)) {
+		if(tag.begin != from) {
+			run(text.substr(from, tag.begin - from));
+		}
+		from = tag.end;
+	}
+	if(from < text.size()) {
+		run(text.substr(from));
+	}
+}
+
+// size of the text once its tags are stripped, without stripping them
+[[nodiscard]] auto stripped_length(std::string_view text) noexcept -> std::size_t;
+
 [[nodiscard]] auto strip_rich_tags(std::string_view text) -> std::string;
 
 [[nodiscard]] auto has_rich_tags(std::string_view text) noexcept -> bool;
 
-} // namespace lge
\ No newline at end of file
+} // namespace lge
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "text_metrics_cache.hpp"
+
+#include <lge/interface/resources.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <entt/core/fwd.hpp>
+#include <functional>
+#include <glm/ext/vector_float2.hpp>
+#include <string_view>
+
+namespace lge {
+
+text_metrics_cache::text_metrics_cache(const std::size_t capacity): capacity_{std::max<std::size_t>(capacity, 1)} {
+	index_.reserve(capacity_);
+}
+
+auto text_metrics_cache::find(const font_handle font, const int size, const std::string_view text)
+	-> const glm::vec2 * {
+	const auto it = index_.find(make_key(font, size, text));
+	if(it == index_.end() || it->second->text != text) {
+		return nullptr;
+	}
+
+	entries_.splice(entries_.begin(), entries_, it->second);
+	return &it->second->measured;
+}
+
+auto text_metrics_cache::insert(const font_handle font,
+								const int size,
+								const std::string_view text,
+								const glm::vec2 &measured) -> void {
+	const auto id = make_key(font, size, text);
+
+	// same key, a different text with the same hash or a new measure: replaced in place
+	if(const auto it = index_.find(id); it != index_.end()) {
+		it->second->text = text;
+		it->second->measured = measured;
+		entries_.splice(entries_.begin(), entries_, it->second);
+		return;
+	}
+
+	if(entries_.size() >= capacity_) {
+		index_.erase(entries_.back().id);
+		entries_.pop_back();
+	}
+
+	entries_.push_front({.id = id, .text = std::string{text}, .measured = measured});
+	index_.emplace(id, entries_.begin());
+}
+
+auto text_metrics_cache::clear() -> void {
+	index_.clear();
+	entries_.clear();
+}
+
+auto text_metrics_cache::key_hash::operator()(const key &k) const noexcept -> std::size_t {
+	constexpr auto mix = static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+	auto seed = k.text_hash;
+	seed ^= std::hash<entt::id_type>{}(k.font) + mix + (seed << 6U) + (seed >> 2U);
+	seed ^= std::hash<int>{}(k.size) + mix + (seed << 6U) + (seed >> 2U);
+	return seed;
+}
+
+auto text_metrics_cache::make_key(const font_handle font, const int size, const std::string_view text) -> key {
+	return {.font = font.raw(), .size = size, .text_hash = std::hash<std::string_view>{}(text)};
+}
+
+} // namespace lge
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <lge/interface/resources.hpp>
+
+#include <cstddef>
+#include <entt/core/fwd.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace lge {
+
+// =============================================================================
+// Text metrics cache
+//
+// Measured sizes of the most recently used texts, keyed by font, size and a
+// hash of the text. Measuring strips rich tags and walks every glyph, so
+// texts drawn every frame, like button captions, are measured once. The
+// least recently used entry is evicted once capacity is reached.
+// =============================================================================
+
+class text_metrics_cache {
+public:
+	static constexpr std::size_t default_capacity = 1024;
+
+	explicit text_metrics_cache(std::size_t capacity = default_capacity);
+
+	// the cached size, marked as the most recently used, or null
+	[[nodiscard]] auto find(font_handle font, int size, std::string_view text) -> const glm::vec2 *;
+	auto insert(font_handle font, int size, std::string_view text, const glm::vec2 &measured) -> void;
+
+	auto clear() -> void;
+
+	[[nodiscard]] auto size() const noexcept -> std::size_t {
+		return entries_.size();
+	}
+
+	[[nodiscard]] auto capacity() const noexcept -> std::size_t {
+		return capacity_;
+	}
+
+private:
+	struct key {
+		entt::id_type font;
+		int size;
+		std::size_t text_hash;
+
+		auto operator==(const key &) const -> bool = default;
+	};
+
+	struct key_hash {
+		auto operator()(const key &k) const noexcept -> std::size_t;
+	};
+
+	struct entry {
+		key id;
+		std::string text; // tells two texts with the same hash apart
+		glm::vec2 measured;
+	};
+
+	std::size_t capacity_;
+	std::list<entry> entries_; // most recently used first
+	std::unordered_map<key, std::list<entry>::iterator, key_hash> index_;
+
+	[[nodiscard]] static auto make_key(font_handle font, int size, std::string_view text) -> key;
+};
+
+} // namespace lge
@@ -1,9 +1,11 @@
 // SPDX-FileCopyrightText: 2026 Juan Medina
 // SPDX-License-Identifier: MIT
 
+#include <lge/core/profiler.hpp>
 #include <lge/core/result.hpp>
 #include <lge/scene/scene.hpp>
 
+#include <cstddef>
 #include <format>
 
 namespace lge {
@@ -25,12 +27,15 @@ auto scene::end() -> result<> {
 		}
 	}
 	systems_.clear();
+	system_names_.clear();
 	return true;
 }
 
 auto scene::update_systems(const float dt) -> result<> {
-	for(const auto &sys: systems_) {
-		if(const auto err = sys->update(dt).unwrap(); err) [[unlikely]] {
+	auto *profiling = ctx.world.ctx().find<profiler>();
+	for(std::size_t i = 0; i < systems_.size(); ++i) {
+		const profiler::scope scope{profiling, system_names_[i], profiler::category::system};
+		if(const auto err = systems_[i]->update(dt).unwrap(); err) [[unlikely]] {
 			return error("failed to update scene system", *err);
 		}
 	}
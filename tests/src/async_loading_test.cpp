@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/sprite.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/backend.hpp>
+#include <lge/interface/resource_manager.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/components/metrics.hpp>
+#include <lge/internal/null/null_backend.hpp>
+#include <lge/internal/resource_manager/async_loader.hpp>
+#include <lge/internal/systems/metrics_system.hpp>
+
+#include "test_helpers.hpp"
+
+#include <array>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+#include <filesystem>
+#include <fstream>
+#include <glm/ext/vector_float2.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using entt::literals::operator""_hs;
+
+// the files of a sprite sheet, its texture and an animation library using it, removed when done
+struct test_files {
+	std::filesystem::path dir = std::filesystem::temp_directory_path() / "lge_async_loading_test";
+
+	test_files() {
+		std::filesystem::create_directories(dir);
+
+		// a png signature and the start of its IHDR chunk, 32x16, all a null texture reads
+		constexpr std::array<std::uint8_t, 24> png{
+			0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R', 0, 0, 0, 32, 0, 0, 0, 16};
+		std::ofstream(dir / "sheet.png", std::ios::binary)
+			.write(reinterpret_cast<const char *>(png.data()), png.size()); // NOLINT(*-reinterpret-cast)
+
+		std::ofstream(dir / "sheet.json") << R"({
+			"frames": {"idle": {"frame": {"x": 0, "y": 0, "w": 16, "h": 16}}},
+			"meta": {"image": "sheet.png"}
+		})";
+		std::ofstream(dir / "anim.json") << R"({
+			"sheet": "sheet.json",
+			"animations": {"idle": {"fps": 8, "frames": ["idle"]}}
+		})";
+	}
+
+	test_files(const test_files &) = delete;
+	test_files(test_files &&) = delete;
+	auto operator=(const test_files &) -> test_files & = delete;
+	auto operator=(test_files &&) -> test_files & = delete;
+
+	~test_files() {
+		std::error_code ignored;
+		std::filesystem::remove_all(dir, ignored);
+	}
+
+	[[nodiscard]] auto path(const char *name) const -> std::string {
+		return (dir / name).string();
+	}
+};
+
+// frames until nothing is pending, each finishing at most max loads
+auto settle(lge::resource_manager &rm, const std::size_t max = 1) -> std::size_t {
+	std::size_t frames = 0;
+	while(rm.pending_loads() != 0) {
+		rm.update_loads(max);
+		++frames;
+		std::this_thread::yield();
+	}
+	return frames;
+}
+
+} // namespace
+
+// =============================================================================
+// Loader
+// =============================================================================
+
+TEST_CASE("async loader: finishes jobs on the calling thread", "[async_loading]") {
+	lge::async_loader loader{2};
+
+	const auto main_thread = std::this_thread::get_id();
+	std::atomic<int> read = 0;
+	std::vector<std::thread::id> finished_on;
+
+	for(int i = 0; i < 3; ++i) {
+		loader.submit([&read, &finished_on]() -> lge::async_loader::finish {
+			read.fetch_add(1);
+			return [&finished_on]() -> void { finished_on.push_back(std::this_thread::get_id()); };
+		});
+	}
+	REQUIRE(loader.pending() == 3);
+
+	SECTION("no more than max finish per call") {
+		while(finished_on.empty()) {
+			loader.complete(1);
+		}
+		REQUIRE(finished_on.size() == 1);
+		REQUIRE(loader.pending() == 2);
+	}
+
+	SECTION("every finish runs where complete is called") {
+		while(loader.pending() != 0) {
+			loader.complete(8);
+		}
+		REQUIRE(read.load() == 3);
+		REQUIRE(finished_on == std::vector<std::thread::id>(3, main_thread));
+	}
+}
+
+TEST_CASE("async loader: without workers complete runs the jobs too", "[async_loading]") {
+	lge::async_loader loader{0};
+
+	int read = 0;
+	int finished = 0;
+	for(int i = 0; i < 3; ++i) {
+		loader.submit([&read, &finished]() -> lge::async_loader::finish {
+			++read;
+			return [&finished]() -> void { ++finished; };
+		});
+	}
+
+	loader.complete(2);
+	REQUIRE(read == 2);
+	REQUIRE(finished == 2);
+	REQUIRE(loader.pending() == 1);
+}
+
+// =============================================================================
+// Resource manager
+// =============================================================================
+
+TEST_CASE("async loading: handles report their load state", "[async_loading][null_backend]") {
+	const test_files files;
+	auto backend = lge::null_backend::create();
+	auto &rm = *backend.resource_manager_ptr;
+
+	SECTION("an animation library is pending until its sprite sheet and texture are ready") {
+		lge::animation_library_handle library;
+		REQUIRE(!rm.load_animation_library_async(files.path("anim.json")).unwrap(library).has_value());
+		REQUIRE(rm.get_load_state(library) == lge::load_state::pending);
+
+		// the library, then its sheet, then its texture, each one frame apart
+		REQUIRE(settle(rm) >= 3);
+		REQUIRE(rm.get_load_state(library) == lge::load_state::ready);
+
+		lge::sprite_sheet_handle sheet;
+		REQUIRE(!rm.get_animation_sprite_sheet(library).unwrap(sheet).has_value());
+		REQUIRE(rm.get_load_state(sheet) == lge::load_state::ready);
+		REQUIRE(rm.get_sprite_sheet_frame(sheet, "idle"_hs).has_value());
+		REQUIRE(rm.get_animation(library, "idle"_hs).has_value());
+
+		REQUIRE(!rm.unload_animation_library(library).unwrap().has_value());
+	}
+
+	SECTION("loading a uri already pending shares its handle") {
+		lge::texture_handle first;
+		lge::texture_handle second;
+		REQUIRE(!rm.load_texture_async(files.path("sheet.png")).unwrap(first).has_value());
+		REQUIRE(!rm.load_texture_async(files.path("sheet.png")).unwrap(second).has_value());
+		REQUIRE(first == second);
+		REQUIRE(rm.pending_loads() == 1);
+
+		settle(rm);
+		REQUIRE(rm.get_load_state(first) == lge::load_state::ready);
+	}
+
+	SECTION("loading a uri already pending right away finishes it") {
+		lge::texture_handle pending;
+		lge::texture_handle loaded;
+		REQUIRE(!rm.load_texture_async(files.path("sheet.png")).unwrap(pending).has_value());
+		REQUIRE(!rm.load_texture(files.path("sheet.png")).unwrap(loaded).has_value());
+		REQUIRE(loaded == pending);
+		REQUIRE(rm.get_load_state(loaded) == lge::load_state::ready);
+
+		// the work left finds it ready and is dropped
+		settle(rm);
+		REQUIRE(rm.get_load_state(loaded) == lge::load_state::ready);
+	}
+
+	SECTION("a missing file fails, and so does what holds it") {
+		std::filesystem::remove(files.dir / "sheet.png");
+
+		lge::sprite_sheet_handle sheet;
+		REQUIRE(!rm.load_sprite_sheet_async(files.path("sheet.json")).unwrap(sheet).has_value());
+		settle(rm);
+		REQUIRE(rm.get_load_state(sheet) == lge::load_state::failed);
+
+		lge::texture_handle missing;
+		REQUIRE(!rm.load_texture_async(files.path("missing.png")).unwrap(missing).has_value());
+		settle(rm);
+		REQUIRE(rm.get_load_state(missing) == lge::load_state::failed);
+	}
+
+	SECTION("unloading a pending handle drops its load") {
+		lge::sprite_sheet_handle sheet;
+		REQUIRE(!rm.load_sprite_sheet_async(files.path("sheet.json")).unwrap(sheet).has_value());
+		REQUIRE(!rm.unload_sprite_sheet(sheet).unwrap().has_value());
+
+		settle(rm);
+		REQUIRE(rm.get_load_state(sheet) == lge::load_state::failed);
+		REQUIRE(rm.get_sprite_sheet_texture(sheet).has_error());
+	}
+
+	REQUIRE(rm.end().has_value());
+}
+
+TEST_CASE("async loading: a sprite on a loading sheet is sized once it is ready", "[async_loading][null_backend]") {
+	const test_files files;
+	system_fixture<lge::metrics_system> f;
+	auto &rm = f.ctx.resources;
+
+	lge::sprite_sheet_handle sheet;
+	REQUIRE(!rm.load_sprite_sheet_async(files.path("sheet.json")).unwrap(sheet).has_value());
+	const auto entity = f.world.create();
+	f.world.emplace<lge::sprite>(entity, lge::sprite{.sheet = sheet, .frame = "idle"_hs});
+
+	// resolved before the sheet is read, and again between the sheet and its texture being ready
+	while(rm.pending_loads() != 0) {
+		must(f.system.update(0.F));
+		REQUIRE(f.world.get<lge::metrics>(entity).size == glm::vec2{0.F, 0.F});
+		rm.update_loads(1);
+		std::this_thread::yield();
+	}
+
+	must(f.system.update(0.F));
+	REQUIRE(f.world.get<lge::metrics>(entity).size == glm::vec2{16.F, 16.F});
+
+	REQUIRE(rm.end().has_value());
+}
@@ -20,7 +20,7 @@ constexpr auto tolerance = 1e-3F;
 
 // Fixture that runs transform_system before bounds_system, matching app.cpp order.
 struct bounds_fixture {
-	lge::backend backend{lge::raylib_backend::create()};
+	lge::backend backend{lge::null_backend::create()};
 	lge::dispatcher dispatcher{};
 	entt::registry world{};
 	lge::context ctx{
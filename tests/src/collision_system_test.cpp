@@ -3,6 +3,10 @@
 
 #include <lge/components/collidable.hpp>
 #include <lge/components/placement.hpp>
+#include <lge/core/result.hpp>
+#include <lge/events/collision.hpp>
+#include <lge/events/collision_ended.hpp>
+#include <lge/internal/collision/spatial_grid.hpp>
 #include <lge/internal/components/bounds.hpp>
 #include <lge/internal/components/overlapping.hpp>
 #include <lge/internal/systems/bounds_system.hpp>
@@ -12,13 +16,16 @@
 #include "test_helpers.hpp"
 
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <tuple>
 
 namespace {
 
 // Runs the full pipeline that app.cpp uses:
-//   transform_system -> bounds_system -> collision_system
+//   transform_system -> bounds_system -> collision_system -> draining the events
 struct collision_fixture {
-	lge::backend backend{lge::raylib_backend::create()};
+	lge::backend backend{lge::null_backend::create()};
 	lge::dispatcher dispatcher{};
 	entt::registry world{};
 	lge::context ctx{
@@ -37,6 +44,7 @@ struct collision_fixture {
 		must(transforms.update(0.F));
 		must(bounds.update(0.F));
 		must(collisions.update(0.F));
+		must(dispatcher.drain());
 	}
 
 	// Creates a collidable entity at the given position, rotation and size (center pivot).
@@ -47,6 +55,13 @@ struct collision_fixture {
 		return e;
 	}
 
+	[[nodiscard]] auto add_collidable(const float x, const float y, const std::uint32_t layer, const std::uint32_t mask)
+		-> entt::entity {
+		const auto e = add_collidable(x, y, 0.F, {20.F, 20.F});
+		world.replace<lge::collidable>(e, lge::collidable{.layer = layer, .mask = mask});
+		return e;
+	}
+
 	[[nodiscard]] auto is_overlapping(const entt::entity e) const -> bool {
 		return world.all_of<lge::overlapping>(e);
 	}
@@ -123,4 +138,249 @@ TEST_CASE("collision: rotation sign symmetry", "[collision][regression]") {
 
 		REQUIRE(both_overlap == both_overlap_reversed);
 	}
+}
+
+// =============================================================================
+// Broadphase grid
+//
+// Collidables are bucketed in a uniform grid; these cover entities spanning
+// several cells, moving between cells and leaving the grid.
+// =============================================================================
+
+TEST_CASE("collision: broadphase grid", "[collision][broadphase]") {
+	collision_fixture f;
+
+	SECTION("large overlapping boxes sharing many cells report a single collision") {
+		auto events = 0;
+		std::ignore = f.dispatcher.subscribe<lge::collision>([&events](const lge::collision &) -> lge::result<> {
+			++events;
+			return true;
+		});
+
+		const auto a = f.add_collidable(0.F, 0.F, 0.F, {400.F, 400.F});
+		const auto b = f.add_collidable(50.F, 50.F, 0.F, {400.F, 400.F});
+		f.update();
+		REQUIRE(f.is_overlapping(a));
+		REQUIRE(f.is_overlapping(b));
+		REQUIRE(events == 1);
+	}
+
+	SECTION("entity moving into and out of another cell is tracked") {
+		const auto a = f.add_collidable(-10.F, -10.F, 0.F, {20.F, 20.F});
+		const auto b = f.add_collidable(1000.F, -1000.F, 0.F, {20.F, 20.F});
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+
+		f.world.get<lge::placement>(b).position = {-5.F, -5.F};
+		f.update();
+		REQUIRE(f.is_overlapping(a));
+		REQUIRE(f.is_overlapping(b));
+
+		f.world.get<lge::placement>(b).position = {1000.F, -1000.F};
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+		REQUIRE_FALSE(f.is_overlapping(b));
+	}
+
+	SECTION("removing collidable takes the entity out of the grid") {
+		const auto a = f.add_collidable(0.F, 0.F, 0.F, {20.F, 20.F});
+		const auto b = f.add_collidable(5.F, 5.F, 0.F, {20.F, 20.F});
+		f.update();
+		REQUIRE(f.is_overlapping(a));
+
+		f.world.remove<lge::collidable>(b);
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+		REQUIRE_FALSE(f.is_overlapping(b));
+	}
+
+	SECTION("destroyed entities leave the grid") {
+		const auto a = f.add_collidable(0.F, 0.F, 0.F, {20.F, 20.F});
+		const auto b = f.add_collidable(5.F, 5.F, 0.F, {20.F, 20.F});
+		f.update();
+		f.world.destroy(b);
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+
+		const auto c = f.add_collidable(5.F, 5.F, 0.F, {20.F, 20.F});
+		f.update();
+		REQUIRE(f.is_overlapping(a));
+		REQUIRE(f.is_overlapping(c));
+	}
+
+	SECTION("a box too large for the grid still collides, once per pair") {
+		auto events = 0;
+		std::ignore = f.dispatcher.subscribe<lge::collision>([&events](const lge::collision &) -> lge::result<> {
+			++events;
+			return true;
+		});
+
+		const auto huge = f.add_collidable(0.F, 0.F, 0.F, {1.0e7F, 1.0e7F});
+		const auto other_huge = f.add_collidable(10.F, 10.F, 0.F, {1.0e7F, 1.0e7F});
+		const auto small = f.add_collidable(4000.F, -3000.F, 0.F, {20.F, 20.F});
+		f.update();
+		REQUIRE(f.is_overlapping(huge));
+		REQUIRE(f.is_overlapping(other_huge));
+		REQUIRE(f.is_overlapping(small));
+		REQUIRE(events == 3);
+	}
+
+	SECTION("far away and invalid bounds are clamped instead of overflowing") {
+		const auto far = f.add_collidable(1.0e30F, -1.0e30F, 0.F, {20.F, 20.F});
+		const auto invalid = f.add_collidable(std::numeric_limits<float>::quiet_NaN(), 0.F, 0.F, {20.F, 20.F});
+		const auto a = f.add_collidable(0.F, 0.F, 0.F, {20.F, 20.F});
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(far));
+		REQUIRE_FALSE(f.is_overlapping(invalid));
+		REQUIRE_FALSE(f.is_overlapping(a));
+	}
+}
+
+TEST_CASE("collision: spatial grid ranges", "[collision][broadphase]") {
+	const lge::spatial_grid grid{64.F};
+
+	SECTION("bounds map to the cells they touch") {
+		const auto range = grid.range_of({-1.F, 0.F}, {64.F, 63.F});
+		REQUIRE(range == lge::cell_range{.min = {-1, 0}, .max = {1, 0}});
+		REQUIRE_FALSE(lge::spatial_grid::is_oversized(range));
+	}
+
+	SECTION("coordinates beyond the grid are clamped") {
+		constexpr auto limit = lge::spatial_grid::max_coordinate;
+		const auto inf = std::numeric_limits<float>::infinity();
+		REQUIRE(grid.range_of({-inf, 1.0e30F}, {-inf, 1.0e30F}) == lge::cell_range{{-limit, limit}, {-limit, limit}});
+	}
+
+	SECTION("huge and NaN bounds are oversized") {
+		REQUIRE(lge::spatial_grid::is_oversized(grid.range_of({0.F, 0.F}, {1.0e6F, 1.0e6F})));
+		const auto nan = std::numeric_limits<float>::quiet_NaN();
+		REQUIRE(lge::spatial_grid::is_oversized(grid.range_of({nan, 0.F}, {0.F, 0.F})));
+	}
+}
+
+// =============================================================================
+// Layers and masks
+// =============================================================================
+
+TEST_CASE("collision: layers and masks", "[collision][layers]") {
+	collision_fixture f;
+	constexpr std::uint32_t players = 1U << 1U;
+	constexpr std::uint32_t enemies = 1U << 2U;
+	constexpr std::uint32_t bullets = 1U << 3U;
+
+	SECTION("default collidables collide with each other") {
+		const auto a = f.add_collidable(0.F, 0.F, 0.F, {20.F, 20.F});
+		const auto b = f.add_collidable(5.F, 5.F, 0.F, {20.F, 20.F});
+		f.update();
+		REQUIRE(f.is_overlapping(a));
+		REQUIRE(f.is_overlapping(b));
+	}
+
+	SECTION("same layer not in the mask does not collide") {
+		const auto a = f.add_collidable(0.F, 0.F, bullets, enemies);
+		const auto b = f.add_collidable(5.F, 5.F, bullets, enemies);
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+		REQUIRE_FALSE(f.is_overlapping(b));
+	}
+
+	SECTION("layers in each other's mask collide") {
+		const auto bullet = f.add_collidable(0.F, 0.F, bullets, enemies);
+		const auto enemy = f.add_collidable(5.F, 5.F, enemies, bullets | players);
+		f.update();
+		REQUIRE(f.is_overlapping(bullet));
+		REQUIRE(f.is_overlapping(enemy));
+	}
+
+	SECTION("a one-sided mask is not enough") {
+		const auto player = f.add_collidable(0.F, 0.F, players, enemies);
+		const auto bullet = f.add_collidable(5.F, 5.F, bullets, enemies);
+		const auto enemy = f.add_collidable(5.F, 5.F, enemies, bullets);
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(player));
+		REQUIRE(f.is_overlapping(bullet));
+		REQUIRE(f.is_overlapping(enemy));
+	}
+
+	SECTION("changing the layer at runtime is picked up") {
+		const auto a = f.add_collidable(0.F, 0.F, bullets, enemies);
+		const auto b = f.add_collidable(5.F, 5.F, bullets, enemies);
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+
+		f.world.replace<lge::collidable>(b, lge::collidable{.layer = enemies, .mask = bullets});
+		f.update();
+		REQUIRE(f.is_overlapping(a));
+		REQUIRE(f.is_overlapping(b));
+
+		f.world.replace<lge::collidable>(b, lge::collidable{.layer = bullets, .mask = enemies});
+		f.update();
+		REQUIRE_FALSE(f.is_overlapping(a));
+		REQUIRE_FALSE(f.is_overlapping(b));
+	}
+}
+
+// =============================================================================
+// Collision start and end events
+// =============================================================================
+
+TEST_CASE("collision: started and ended events", "[collision][events]") {
+	collision_fixture f;
+	auto started = 0;
+	auto ended = 0;
+	std::ignore = f.dispatcher.subscribe<lge::collision>([&started](const lge::collision &) -> lge::result<> {
+		++started;
+		return true;
+	});
+	std::ignore = f.dispatcher.subscribe<lge::collision_ended>([&ended](const lge::collision_ended &) -> lge::result<> {
+		++ended;
+		return true;
+	});
+
+	const auto a = f.add_collidable(0.F, 0.F, 0.F, {20.F, 20.F});
+	const auto b = f.add_collidable(5.F, 5.F, 0.F, {20.F, 20.F});
+
+	SECTION("a collision is reported once while the pair keeps overlapping") {
+		f.update();
+		f.update();
+		f.update();
+		REQUIRE(started == 1);
+		REQUIRE(ended == 0);
+	}
+
+	SECTION("separating posts a single ended event with the pair") {
+		f.update();
+		auto ended_pair = lge::collision_ended{.first = entt::null, .second = entt::null};
+		std::ignore =
+			f.dispatcher.subscribe<lge::collision_ended>([&ended_pair](const lge::collision_ended &e) -> lge::result<> {
+				ended_pair = e;
+				return true;
+			});
+
+		f.world.get<lge::placement>(b).position = {500.F, 500.F};
+		f.update();
+		f.update();
+		REQUIRE(ended == 1);
+		const auto same_order = ended_pair.first == a && ended_pair.second == b;
+		const auto swapped = ended_pair.first == b && ended_pair.second == a;
+		REQUIRE((same_order || swapped));
+	}
+
+	SECTION("overlapping again after separating starts a new collision") {
+		f.update();
+		f.world.get<lge::placement>(b).position = {500.F, 500.F};
+		f.update();
+		f.world.get<lge::placement>(b).position = {5.F, 5.F};
+		f.update();
+		REQUIRE(started == 2);
+		REQUIRE(ended == 1);
+	}
+
+	SECTION("destroying one entity ends the collision") {
+		f.update();
+		f.world.destroy(b);
+		f.update();
+		REQUIRE(ended == 1);
+		REQUIRE(f.world.valid(a));
+	}
 }
\ No newline at end of file
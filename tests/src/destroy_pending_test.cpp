@@ -15,7 +15,7 @@ namespace {
 using simple_fixture = system_fixture<lge::destroy_pending_system>;
 
 struct hierarchy_fixture {
-	lge::backend backend{lge::raylib_backend::create()};
+	lge::backend backend{lge::null_backend::create()};
 	lge::dispatcher dispatcher{};
 	entt::registry world{};
 	lge::context ctx{
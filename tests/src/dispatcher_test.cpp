@@ -2,10 +2,19 @@
 // SPDX-License-Identifier: MIT
 
 #include <lge/dispatcher/dispatcher.hpp>
+#include <lge/dispatcher/thread_slot.hpp>
 
 #include "test_helpers.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 // =============================================================================
 // Test Events
@@ -319,4 +328,284 @@ TEST_CASE("dispatcher: error propagation", "[dispatcher]") {
 		REQUIRE(result.has_error());
 		require_log({"first"});
 	}
-}
\ No newline at end of file
+}
+// =============================================================================
+// Inline Handlers
+// =============================================================================
+
+TEST_CASE("dispatcher: inline handlers", "[dispatcher]") {
+	SECTION("captured state survives handlers being moved as more subscribe") {
+		lge::dispatcher dispatcher;
+
+		std::vector<int> received(16, 0);
+		for(std::size_t i = 0; i < received.size(); ++i) {
+			std::ignore = dispatcher.subscribe<event_b>([&received, i](const event_b &e) -> lge::result<> {
+				received[i] += e.value;
+				return true;
+			});
+		}
+
+		must(dispatcher.post(event_b{.value = 3}));
+		REQUIRE(received == std::vector<int>(16, 3));
+	}
+
+	SECTION("mutable handlers keep their state between posts") {
+		test_log.clear();
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_a>([count = 0](const event_a &) mutable -> lge::result<> {
+			test_log.emplace_back(std::to_string(++count));
+			return true;
+		});
+
+		must(dispatcher.post(event_a{}));
+		must(dispatcher.post(event_a{}));
+		require_log({"1", "2"});
+	}
+
+	SECTION("a handler may subscribe to another event type while posting") {
+		test_log.clear();
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_a>([&dispatcher](const event_a &) -> lge::result<> {
+			std::ignore = dispatcher.subscribe<event_c>([](const event_c &e) -> lge::result<> {
+				test_log.emplace_back(e.text);
+				return true;
+			});
+			test_log.emplace_back("a");
+			return true;
+		});
+
+		must(dispatcher.post(event_a{}));
+		must(dispatcher.post(event_c{.text = "c"}));
+		require_log({"a", "c"});
+	}
+}
+
+// =============================================================================
+// Queued Events
+// =============================================================================
+
+TEST_CASE("dispatcher: queued events", "[dispatcher][queue]") {
+	SECTION("queued events reach handlers only when drained") {
+		test_log.clear();
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_b>([](const event_b &e) -> lge::result<> {
+			test_log.emplace_back("b:" + std::to_string(e.value));
+			return true;
+		});
+
+		dispatcher.enqueue(event_b{.value = 1});
+		dispatcher.enqueue(event_b{.value = 2});
+		require_log({});
+
+		must(dispatcher.drain());
+		require_log({"b:1", "b:2"});
+	}
+
+	SECTION("batch handlers get every queued event in one span") {
+		lge::dispatcher dispatcher;
+
+		std::vector<std::vector<int>> batches;
+		std::ignore =
+			dispatcher.subscribe_batch<event_b>([&batches](const std::span<const event_b> events) -> lge::result<> {
+				auto &batch = batches.emplace_back();
+				for(const auto &e: events) {
+					batch.push_back(e.value);
+				}
+				return true;
+			});
+
+		for(int i = 0; i < 3; ++i) {
+			dispatcher.enqueue(event_b{.value = i});
+		}
+		must(dispatcher.drain());
+
+		REQUIRE(batches == std::vector<std::vector<int>>{{0, 1, 2}});
+	}
+
+	SECTION("batch handlers are not called for posted events") {
+		auto calls = 0;
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe_batch<event_a>([&calls](const std::span<const event_a>) -> lge::result<> {
+			++calls;
+			return true;
+		});
+
+		must(dispatcher.post(event_a{}));
+		must(dispatcher.drain());
+		REQUIRE(calls == 0);
+	}
+
+	SECTION("drained events are not delivered again") {
+		auto calls = 0;
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_a>([&calls](const event_a &) -> lge::result<> {
+			++calls;
+			return true;
+		});
+
+		dispatcher.enqueue(event_a{});
+		must(dispatcher.drain());
+		must(dispatcher.drain());
+		REQUIRE(calls == 1);
+	}
+
+	SECTION("events queued by handlers are delivered in the same drain") {
+		test_log.clear();
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_a>([&dispatcher](const event_a &) -> lge::result<> {
+			test_log.emplace_back("a");
+			dispatcher.enqueue(event_c{.text = "c"});
+			return true;
+		});
+		std::ignore = dispatcher.subscribe<event_c>([](const event_c &e) -> lge::result<> {
+			test_log.emplace_back(e.text);
+			return true;
+		});
+
+		dispatcher.enqueue(event_a{});
+		must(dispatcher.drain());
+		require_log({"a", "c"});
+	}
+
+	SECTION("handlers queuing forever make drain fail") {
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_a>([&dispatcher](const event_a &) -> lge::result<> {
+			dispatcher.enqueue(event_a{});
+			return true;
+		});
+
+		dispatcher.enqueue(event_a{});
+		REQUIRE(dispatcher.drain().has_error());
+	}
+
+	SECTION("a handler error stops the drain") {
+		lge::dispatcher dispatcher;
+
+		std::ignore = dispatcher.subscribe<event_a>(
+			[](const event_a &) -> lge::result<> { return lge::error("handler failed"); });
+
+		dispatcher.enqueue(event_a{});
+		REQUIRE(dispatcher.drain().has_error());
+	}
+
+	SECTION("unsubscribing a batch handler stops its batches") {
+		auto calls = 0;
+		lge::dispatcher dispatcher;
+
+		const auto token =
+			dispatcher.subscribe_batch<event_a>([&calls](const std::span<const event_a>) -> lge::result<> {
+				++calls;
+				return true;
+			});
+
+		must(dispatcher.unsubscribe(token));
+		dispatcher.enqueue(event_a{});
+		must(dispatcher.drain());
+		REQUIRE(calls == 0);
+	}
+}
+
+// =============================================================================
+// Queuing From Threads
+// =============================================================================
+
+namespace {
+
+struct ordered_event {
+	int value{};
+
+	auto operator<=>(const ordered_event &) const = default;
+};
+
+} // namespace
+
+TEST_CASE("dispatcher: queuing from threads", "[dispatcher][queue][threads]") {
+	constexpr auto threads = 4;
+	constexpr auto per_thread = 250;
+
+	SECTION("every event queued from any thread is drained") {
+		lge::dispatcher dispatcher;
+		dispatcher.prepare<event_b>();
+
+		auto sum = 0;
+		std::ignore = dispatcher.subscribe<event_b>([&sum](const event_b &e) -> lge::result<> {
+			sum += e.value;
+			return true;
+		});
+
+		std::vector<std::thread> workers;
+		for(auto t = 0; t < threads; ++t) {
+			workers.emplace_back([&dispatcher]() -> void {
+				for(auto i = 0; i < per_thread; ++i) {
+					dispatcher.enqueue(event_b{.value = 1});
+				}
+			});
+		}
+		for(auto &w: workers) {
+			w.join();
+		}
+
+		must(dispatcher.drain());
+		REQUIRE(sum == threads * per_thread);
+	}
+
+	SECTION("ordered events are delivered in the same order however the work was split") {
+		lge::dispatcher dispatcher;
+
+		std::vector<int> received;
+		std::ignore = dispatcher.subscribe_batch<ordered_event>(
+			[&received](const std::span<const ordered_event> events) -> lge::result<> {
+				for(const auto &e: events) {
+					received.push_back(e.value);
+				}
+				return true;
+			});
+
+		// interleaved, so no thread queues a sorted run of its own
+		std::vector<std::thread> workers;
+		for(auto t = threads - 1; t >= 0; --t) {
+			workers.emplace_back([&dispatcher, t]() -> void {
+				for(auto i = per_thread - 1; i >= 0; --i) {
+					dispatcher.enqueue(ordered_event{.value = (i * threads) + t});
+				}
+			});
+		}
+		for(auto &w: workers) {
+			w.join();
+		}
+
+		must(dispatcher.drain());
+		REQUIRE(received.size() == static_cast<std::size_t>(threads * per_thread));
+		REQUIRE(std::ranges::is_sorted(received));
+	}
+
+	SECTION("threads alive at the same time have their own slots") {
+		std::array<std::size_t, threads> slots{};
+		std::atomic<int> arrived{0};
+
+		std::vector<std::thread> workers;
+		for(auto t = 0; t < threads; ++t) {
+			workers.emplace_back([&slots, &arrived, t]() -> void {
+				slots[static_cast<std::size_t>(t)] = lge::thread_slot::current();
+				// keep every thread alive until all of them took a slot
+				arrived.fetch_add(1);
+				while(arrived.load() < threads) {
+					std::this_thread::yield();
+				}
+			});
+		}
+		for(auto &w: workers) {
+			w.join();
+		}
+
+		std::ranges::sort(slots);
+		REQUIRE(std::ranges::adjacent_find(slots) == slots.end());
+	}
+}
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/colors.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/interface/resources.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+auto make_sprite(const std::uint32_t sheet) -> lge::sprite_draw {
+	return lge::sprite_draw{
+		.sheet = lge::sprite_sheet_handle::from_id(sheet),
+		.frame = 0,
+		.pivot_position = {0.F, 0.F},
+		.size = {16.F, 16.F},
+		.pivot = {0.5F, 0.5F},
+		.rotation = 0.F,
+		.flip_horizontal = false,
+		.flip_vertical = false,
+		.tint = lge::colors::white,
+		.source = {},
+	};
+}
+
+// number of times consecutive sprite commands change sheet, each one a separate GPU draw
+auto texture_switches(const lge::draw_list &list) -> std::size_t {
+	std::size_t switches = 0;
+	auto current = lge::invalid_sprite_sheet;
+	for(const auto &cmd: list.commands()) {
+		if(const auto sheet = list.sprites()[cmd.payload].sheet; sheet != current) {
+			++switches;
+			current = sheet;
+		}
+	}
+	return switches;
+}
+
+} // namespace
+
+// =============================================================================
+// Sort key
+// =============================================================================
+
+TEST_CASE("draw_list: sort key", "[render][draw_list]") {
+	using lge::draw_list;
+
+	SECTION("layer is the most significant field") {
+		REQUIRE(draw_list::make_key(0, 100, 0xFFFFFF) < draw_list::make_key(1, 0, 0));
+	}
+
+	SECTION("negative layers and indices draw before positive ones") {
+		REQUIRE(draw_list::make_key(-1, 0, 0) < draw_list::make_key(0, 0, 0));
+		REQUIRE(draw_list::make_key(0, -5, 0) < draw_list::make_key(0, 5, 0));
+	}
+
+	SECTION("index comes before texture") {
+		REQUIRE(draw_list::make_key(0, 0, 0xFFFFFF) < draw_list::make_key(0, 1, 0));
+	}
+
+	SECTION("the kind is added with the command") {
+		lge::draw_list list;
+		list.add(draw_list::make_key(0, 0, 1), make_sprite(1));
+		REQUIRE((list.commands()[0].key & 0xFFU) == static_cast<std::uint8_t>(lge::draw_kind::sprite));
+	}
+}
+
+// =============================================================================
+// Sorting
+// =============================================================================
+
+TEST_CASE("draw_list: sorting", "[render][draw_list]") {
+	lge::draw_list list;
+
+	SECTION("commands with the same key keep their submission order") {
+		const auto key = lge::draw_list::make_key(0, 0, 1);
+		for(std::uint32_t i = 0; i < 100; ++i) {
+			auto sprite = make_sprite(1);
+			sprite.frame = i;
+			list.add(key, sprite);
+		}
+		list.sort();
+
+		const auto commands = list.commands();
+		for(std::size_t i = 0; i < commands.size(); ++i) {
+			REQUIRE(list.sprites()[commands[i].payload].frame == i);
+		}
+	}
+
+	SECTION("higher layers draw after lower layers regardless of submission order") {
+		list.add(lge::draw_list::make_key(2, 0, 1), make_sprite(1));
+		list.add(lge::draw_list::make_key(1, 0, 2), make_sprite(2));
+		list.sort();
+		REQUIRE(list.sprites()[list.commands()[0].payload].sheet.raw() == 2);
+		REQUIRE(list.sprites()[list.commands()[1].payload].sheet.raw() == 1);
+	}
+
+	SECTION("interleaved sprites from three sheets that do not overlap collapse into three texture runs") {
+		constexpr std::uint32_t sheets = 3;
+		for(std::uint32_t i = 0; i < 48; ++i) {
+			const auto sheet = (i % sheets) + 1;
+			const auto x = static_cast<float>(i) * 20.F;
+			list.cover({x, 0.F}, {x + 16.F, 16.F});
+			list.add(lge::draw_list::make_key(0, 0, sheet), make_sprite(sheet));
+		}
+		REQUIRE(texture_switches(list) == 48);
+
+		list.sort();
+		REQUIRE(texture_switches(list) == sheets);
+	}
+
+	SECTION("5k interleaved sprites batch within the look back window") {
+		constexpr std::uint32_t sheets = 3;
+		constexpr std::uint32_t count = 5'000;
+		for(std::uint32_t i = 0; i < count; ++i) {
+			const auto sheet = (i % sheets) + 1;
+			const auto x = static_cast<float>(i) * 20.F;
+			list.cover({x, 0.F}, {x + 16.F, 16.F});
+			list.add(lge::draw_list::make_key(0, 0, sheet), make_sprite(sheet));
+		}
+		list.sort();
+		REQUIRE(texture_switches(list) <= count / lge::draw_list::batch_window * sheets);
+	}
+
+	SECTION("overlapping draws keep their order even if that costs a texture switch") {
+		// a panel, a label on top of it and a second panel somewhere else sharing the first one's texture
+		list.cover({0.F, 0.F}, {100.F, 100.F});
+		list.add(lge::draw_list::make_key(0, 0, 1), make_sprite(1));
+		list.cover({10.F, 10.F}, {50.F, 20.F});
+		list.add(lge::draw_list::make_key(0, 0, 2), make_sprite(2));
+		list.cover({200.F, 0.F}, {300.F, 100.F});
+		list.add(lge::draw_list::make_key(0, 0, 1), make_sprite(1));
+		list.cover({20.F, 15.F}, {40.F, 40.F});
+		list.add(lge::draw_list::make_key(0, 0, 1), make_sprite(1));
+		list.sort();
+
+		// the far away panel joins the first one, the last sprite can not pass the label it overlaps
+		const auto commands = list.commands();
+		REQUIRE(commands[0].sequence == 0);
+		REQUIRE(commands[1].sequence == 2);
+		REQUIRE(commands[2].sequence == 1);
+		REQUIRE(commands[3].sequence == 3);
+	}
+
+	SECTION("draws without an area never move") {
+		list.add(lge::draw_list::make_key(0, 0, 1), make_sprite(1));
+		list.add(lge::draw_list::make_key(0, 0, 2), make_sprite(2));
+		list.add(lge::draw_list::make_key(0, 0, 1), make_sprite(1));
+		list.sort();
+		REQUIRE(texture_switches(list) == 3);
+	}
+
+	SECTION("clear drops commands and payloads") {
+		list.add(0, make_sprite(1));
+		list.add(0, lge::quad_draw{});
+		list.clear();
+		REQUIRE(list.commands().empty());
+		REQUIRE(list.sprites().empty());
+		REQUIRE(list.quads().empty());
+	}
+}
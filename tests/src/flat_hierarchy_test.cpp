@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/hierarchy.hpp>
+#include <lge/internal/hierarchy/flat_hierarchy.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+auto index_of(const lge::flat_hierarchy &hierarchy, const entt::entity e) -> std::size_t {
+	const auto entities = hierarchy.entities();
+	return static_cast<std::size_t>(std::distance(entities.begin(), std::ranges::find(entities, e)));
+}
+
+auto contains(const lge::flat_hierarchy &hierarchy, const entt::entity e) -> bool {
+	return index_of(hierarchy, e) < hierarchy.size();
+}
+
+auto parent_of(const lge::flat_hierarchy &hierarchy, const entt::entity e) -> entt::entity {
+	const auto parent_index = hierarchy.parents()[index_of(hierarchy, e)];
+	return parent_index == lge::flat_hierarchy::no_parent ? entt::null : hierarchy.entities()[parent_index];
+}
+
+} // namespace
+
+// =============================================================================
+// Layout
+// =============================================================================
+
+TEST_CASE("flat_hierarchy: layout", "[hierarchy][flat]") {
+	entt::registry world;
+
+	SECTION("entities without hierarchy are not included") {
+		const auto e = add_entity(world);
+		REQUIRE(!contains(lge::flat_hierarchy::of(world), e));
+	}
+
+	SECTION("parents come before their descendants") {
+		const auto root = add_entity(world);
+		const auto child = add_child(world, root);
+		const auto grandchild = add_child(world, child);
+		const auto &hierarchy = lge::flat_hierarchy::of(world);
+		REQUIRE(index_of(hierarchy, root) < index_of(hierarchy, child));
+		REQUIRE(index_of(hierarchy, child) < index_of(hierarchy, grandchild));
+		REQUIRE(parent_of(hierarchy, root) == entt::null);
+		REQUIRE(parent_of(hierarchy, child) == root);
+		REQUIRE(parent_of(hierarchy, grandchild) == child);
+	}
+
+	SECTION("each root subtree is contiguous") {
+		const auto root1 = add_entity(world);
+		const auto root2 = add_entity(world);
+		const auto child1 = add_child(world, root1);
+		const auto child2 = add_child(world, root2);
+		const auto grandchild1 = add_child(world, child1);
+		const auto &hierarchy = lge::flat_hierarchy::of(world);
+		REQUIRE(hierarchy.size() == 5);
+		const auto first = index_of(hierarchy, root1);
+		REQUIRE(index_of(hierarchy, child1) == first + 1);
+		REQUIRE(index_of(hierarchy, grandchild1) == first + 2);
+		REQUIRE(index_of(hierarchy, child2) == index_of(hierarchy, root2) + 1);
+	}
+}
+
+// =============================================================================
+// Invalidation
+// =============================================================================
+
+TEST_CASE("flat_hierarchy: invalidation", "[hierarchy][flat]") {
+	entt::registry world;
+	const auto root = add_entity(world);
+	const auto child = add_child(world, root);
+	REQUIRE(lge::flat_hierarchy::of(world).size() == 2);
+
+	SECTION("attaching a child rebuilds the hierarchy") {
+		const auto other = add_child(world, child);
+		const auto &hierarchy = lge::flat_hierarchy::of(world);
+		REQUIRE(hierarchy.size() == 3);
+		REQUIRE(parent_of(hierarchy, other) == child);
+	}
+
+	SECTION("destroying a child rebuilds the hierarchy") {
+		world.destroy(child);
+		REQUIRE(!contains(lge::flat_hierarchy::of(world), child));
+	}
+
+	SECTION("destroying a root rebuilds the hierarchy") {
+		world.destroy(root);
+		REQUIRE(!contains(lge::flat_hierarchy::of(world), root));
+	}
+
+	SECTION("reattaching a child follows the new parent") {
+		const auto other_root = add_entity(world);
+		world.erase<lge::parent>(child);
+		std::erase(world.get<lge::children>(root).ids, child);
+		lge::attach(world, other_root, child);
+		REQUIRE(parent_of(lge::flat_hierarchy::of(world), child) == other_root);
+	}
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/label.hpp>
+#include <lge/core/colors.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/internal/components/label_layout.hpp>
+#include <lge/internal/null/null_backend.hpp>
+#include <lge/internal/null/null_renderer.hpp>
+#include <lge/internal/systems/metrics_system.hpp>
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <glm/ext/vector_float2.hpp>
+
+// =============================================================================
+// Layout
+// =============================================================================
+
+TEST_CASE("label layout: glyphs are laid out once per change", "[label_layout][metrics]") {
+	system_fixture<lge::metrics_system> f;
+	const auto e = f.world.create();
+	f.world.emplace<lge::label>(e, lge::label{.text = "ab c", .text_color = lge::colors::white, .size = 10.F});
+
+	must(f.system.update(0.F));
+
+	SECTION("every visible glyph is a quad on the measured advance") {
+		const auto &layout = f.world.get<lge::label_layout>(e).glyphs;
+		REQUIRE(layout.size == 10.F);
+		REQUIRE(layout.glyphs.size() == 3);
+		REQUIRE(layout.glyphs[0].offset == glm::vec2{0.F, 0.F});
+		REQUIRE(layout.glyphs[1].offset == glm::vec2{5.F, 0.F});
+		REQUIRE(layout.glyphs[2].offset == glm::vec2{15.F, 0.F});
+		REQUIRE(layout.glyphs[2].tint == lge::colors::white);
+	}
+
+	SECTION("new lines start again at the left") {
+		f.world.get<lge::label>(e).text = "a\nb";
+		must(f.system.update(0.F));
+		const auto &layout = f.world.get<lge::label_layout>(e).glyphs;
+		REQUIRE(layout.glyphs.size() == 2);
+		REQUIRE(layout.glyphs[1].offset == glm::vec2{0.F, 10.F});
+	}
+
+	SECTION("rich tags color their glyphs and are not laid out") {
+		f.world.get<lge::label>(e).text = "a{#FF0000}b{#}c";
+		must(f.system.update(0.F));
+		const auto &layout = f.world.get<lge::label_layout>(e).glyphs;
+		REQUIRE(layout.glyphs.size() == 3);
+		REQUIRE(layout.glyphs[0].tint == lge::colors::white);
+		REQUIRE(layout.glyphs[1].tint == lge::color::from_hex(0xFF0000FF));
+		REQUIRE(layout.glyphs[1].offset == glm::vec2{5.F, 0.F});
+		REQUIRE(layout.glyphs[2].tint == lge::colors::white);
+	}
+}
+
+// =============================================================================
+// Drawing
+// =============================================================================
+
+TEST_CASE("label layout: laid out glyphs are submitted as glyph draws", "[label_layout][render]") {
+	auto backend = lge::null_backend::create();
+	auto &renderer = static_cast<lge::null_renderer &>(*backend.renderer_ptr);
+
+	const auto layout = renderer.layout_label({}, "play", 10, lge::colors::white);
+	lge::draw_list list;
+	list.add(lge::draw_list::make_key(0, 0, 0),
+			 lge::glyph_draw{
+				 .layout = &layout,
+				 .scale = 2.F,
+				 .pivot_position = {0.F, 0.F},
+				 .rotated_offset = {0.F, 0.F},
+				 .rotation = 0.F,
+			 });
+	list.sort();
+	renderer.submit(list);
+
+	REQUIRE(renderer.recorded_count(lge::draw_kind::glyphs) == 1);
+	REQUIRE(renderer.recorded_count(lge::draw_kind::label) == 0);
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/internal/collision/narrow_phase.hpp>
+#include <lge/internal/components/bounds.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <glm/ext/vector_float2.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+// rectangle of the given half size rotated around its center, corners in winding order
+auto make_quad(const glm::vec2 &center, const glm::vec2 &half, const float radians) -> lge::bounds {
+	const auto c = std::cos(radians);
+	const auto s = std::sin(radians);
+	const auto corner = [&](const float x, const float y) -> glm::vec2 {
+		return center + glm::vec2{(c * x) - (s * y), (s * x) + (c * y)};
+	};
+	return lge::bounds{
+		.p0 = corner(-half.x, -half.y),
+		.p1 = corner(half.x, -half.y),
+		.p2 = corner(half.x, half.y),
+		.p3 = corner(-half.x, half.y),
+	};
+}
+
+struct quad_generator {
+	std::mt19937 rng{1234};
+	std::uniform_real_distribution<float> position{0.F, 100.F};
+	std::uniform_real_distribution<float> half_size{1.F, 30.F};
+	std::uniform_real_distribution<float> angle{0.F, 6.2831853F};
+
+	auto next() -> lge::bounds {
+		return make_quad({position(rng), position(rng)}, {half_size(rng), half_size(rng)}, angle(rng));
+	}
+};
+
+} // namespace
+
+// =============================================================================
+// Oriented quad narrow phase
+// =============================================================================
+
+TEST_CASE("narrow_phase: quads_overlap", "[collision][narrow_phase]") {
+	SECTION("separated quads do not overlap") {
+		const auto a = make_quad({0.F, 0.F}, {10.F, 10.F}, 0.F);
+		const auto b = make_quad({30.F, 0.F}, {10.F, 10.F}, 0.F);
+		REQUIRE_FALSE(lge::quads_overlap(a, b));
+	}
+
+	SECTION("a quad contained in another overlaps") {
+		const auto a = make_quad({0.F, 0.F}, {50.F, 50.F}, 0.F);
+		const auto b = make_quad({5.F, 5.F}, {2.F, 2.F}, 0.7F);
+		REQUIRE(lge::quads_overlap(a, b));
+		REQUIRE(lge::quads_overlap(b, a));
+	}
+
+	SECTION("rotated quads separated only along a diagonal do not overlap") {
+		// the AABBs overlap but the 45 degree quads are apart
+		const auto a = make_quad({0.F, 0.F}, {10.F, 10.F}, 0.785398F);
+		const auto b = make_quad({22.F, 22.F}, {10.F, 10.F}, 0.785398F);
+		REQUIRE_FALSE(lge::quads_overlap(a, b));
+	}
+}
+
+TEST_CASE("narrow_phase: matches the triangulated test", "[collision][narrow_phase]") {
+	quad_generator quads;
+
+	SECTION("scalar test") {
+		for(std::size_t i = 0; i < 1'000; ++i) {
+			const auto a = quads.next();
+			const auto b = quads.next();
+			REQUIRE(lge::quads_overlap(a, b) == lge::quads_overlap_triangulated(a, b));
+		}
+	}
+
+	SECTION("batch test, including a tail that does not fill a full batch") {
+		constexpr std::size_t candidates = 11;
+		for(std::size_t i = 0; i < 200; ++i) {
+			const auto a = quads.next();
+			lge::quad_batch batch;
+			std::vector<lge::bounds> others;
+			for(std::size_t j = 0; j < candidates; ++j) {
+				others.push_back(quads.next());
+				batch.push(others.back());
+			}
+
+			std::vector<std::uint8_t> hits(candidates);
+			lge::quads_overlap_batch(a, batch, hits);
+			for(std::size_t j = 0; j < candidates; ++j) {
+				REQUIRE((hits[j] != 0) == lge::quads_overlap_triangulated(a, others[j]));
+			}
+		}
+	}
+}
@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/app/app.hpp>
+#include <lge/app/app_config.hpp>
+#include <lge/components/hierarchy.hpp>
+#include <lge/components/label.hpp>
+#include <lge/components/panel.hpp>
+#include <lge/components/placement.hpp>
+#include <lge/components/shapes.hpp>
+#include <lge/core/profiler.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/internal/null/null_backend.hpp>
+#include <lge/internal/null/null_input.hpp>
+#include <lge/internal/null/null_renderer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <string_view>
+
+// =============================================================================
+// Test app
+// =============================================================================
+
+class headless_app: public lge::app {
+public:
+	headless_app(): app(lge::null_backend::create(0.25F)) {}
+
+	auto update(const float dt) -> lge::result<> override {
+		++frames;
+		elapsed += dt;
+		return true;
+	}
+
+	using app::profiling;
+	using app::simulation_steps;
+
+	[[nodiscard]] auto recorded() const -> const lge::null_renderer & {
+		return dynamic_cast<const lge::null_renderer &>(ctx.render);
+	}
+
+	std::size_t frames = 0;
+	float elapsed = 0.F;
+
+protected:
+	auto init() -> lge::result<> override {
+		if(const auto err = app::init().unwrap(); err) [[unlikely]] {
+			return lge::error("failed to init headless app", *err);
+		}
+		const auto box = ctx.world.create();
+		ctx.world.emplace<lge::placement>(box, lge::placement{10.F, 20.F});
+		ctx.world.emplace<lge::rect>(box, lge::rect{.size = {32.F, 16.F}});
+		return true;
+	}
+};
+
+// steps the simulation every 0.1875s, which a 0.25s frame runs 1, 1 and 2 times in turn
+class fixed_step_app: public headless_app {
+public:
+	explicit fixed_step_app(const std::size_t max_steps = 5): max_steps_{max_steps} {}
+
+	auto configure() -> lge::app_config override {
+		auto config = headless_app::configure();
+		config.fixed_timestep = 0.1875F;
+		config.max_steps_per_frame = max_steps_;
+		return config;
+	}
+
+private:
+	std::size_t max_steps_;
+};
+
+// the jump action is pressed and released before the first frame, each step counts the edges it sees
+class edge_app: public headless_app {
+public:
+	explicit edge_app(const float fixed_timestep): fixed_timestep_{fixed_timestep} {}
+
+	auto configure() -> lge::app_config override {
+		auto config = headless_app::configure();
+		config.fixed_timestep = fixed_timestep_;
+		return config;
+	}
+
+	auto update(const float dt) -> lge::result<> override {
+		if(const auto err = headless_app::update(dt).unwrap(); err) [[unlikely]] {
+			return lge::error("failed to update edge app", *err);
+		}
+		const auto &jump = ctx.actions.get(jump_action);
+		if(jump.pressed) {
+			++presses;
+			pressed_on_step = frames;
+		}
+		releases += jump.released ? 1 : 0;
+		return true;
+	}
+
+	static constexpr lge::input::id jump_action = 0;
+
+	std::size_t presses = 0;
+	std::size_t releases = 0;
+	std::size_t pressed_on_step = 0;
+
+protected:
+	auto init() -> lge::result<> override {
+		if(const auto err = headless_app::init().unwrap(); err) [[unlikely]] {
+			return lge::error("failed to init edge app", *err);
+		}
+		auto &input = dynamic_cast<lge::null_input &>(ctx.actions);
+		input.press(jump_action);
+		input.release(jump_action);
+		return true;
+	}
+
+private:
+	float fixed_timestep_;
+};
+
+// a popup panel with a label and, over the label, a rect as children, in no particular order
+class popup_app: public headless_app {
+protected:
+	auto init() -> lge::result<> override {
+		if(const auto err = headless_app::init().unwrap(); err) [[unlikely]] {
+			return lge::error("failed to init popup app", *err);
+		}
+		const auto popup = ctx.world.create();
+		ctx.world.emplace<lge::panel>(popup, lge::panel{.size = {200.F, 90.F}, .border = 15.F});
+		ctx.world.emplace<lge::placement>(popup, lge::placement{300.F, 300.F});
+
+		const auto caption = ctx.world.create();
+		ctx.world.emplace<lge::label>(caption, lge::label{.text = "Are you sure?", .size = 20.F});
+		ctx.world.emplace<lge::placement>(caption, lge::placement{0.F, -20.F});
+		lge::attach(ctx.world, popup, caption);
+
+		const auto cover = ctx.world.create();
+		ctx.world.emplace<lge::rect>(cover, lge::rect{.size = {40.F, 40.F}});
+		ctx.world.emplace<lge::placement>(cover, lge::placement{0.F, -20.F});
+		lge::attach(ctx.world, popup, cover);
+		return true;
+	}
+};
+
+namespace {
+
+// position of the last draw of one of the kinds, -1 if there is none
+auto last_of(const std::span<const lge::recorded_draw> draws, const std::initializer_list<lge::draw_kind> kinds)
+	-> std::ptrdiff_t {
+	const auto it = std::find_if(draws.rbegin(), draws.rend(), [kinds](const auto &draw) -> bool {
+		return std::ranges::find(kinds, draw.kind) != kinds.end();
+	});
+	return std::distance(it, draws.rend()) - 1;
+}
+
+} // namespace
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+TEST_CASE("null backend: runs full frames headless", "[null_backend]") {
+	headless_app application;
+
+	must(application.run_for(8));
+
+	SECTION("every frame takes the fixed frame time") {
+		REQUIRE(application.frames == 8);
+		REQUIRE(application.elapsed == Catch::Approx(2.F));
+		REQUIRE(application.recorded().frame_count() == 8);
+	}
+
+	SECTION("the profiler times every frame and system") {
+		const auto samples = application.profiling().snapshot();
+		REQUIRE(std::ranges::count_if(samples, [](const auto &s) -> bool {
+					return s.kind == lge::profiler::category::frame;
+				}) == 8);
+		REQUIRE(std::ranges::any_of(samples, [&application](const auto &s) -> bool {
+			return application.profiling().name_of(s.name).find("render_system") != std::string_view::npos;
+		}));
+	}
+
+	SECTION("draws are recorded instead of issued") {
+		REQUIRE(application.recorded().recorded_count(lge::draw_kind::rect) == 1);
+		REQUIRE(application.recorded().recorded_count(lge::draw_kind::sprite) == 0);
+	}
+}
+
+TEST_CASE("null backend: children draw over their parent", "[null_backend][render]") {
+	popup_app application;
+	must(application.run_for(1));
+
+	const auto draws = application.recorded().recorded_draws();
+	const auto panel_at = last_of(draws, {lge::draw_kind::panel});
+	const auto label_at = last_of(draws, {lge::draw_kind::label, lge::draw_kind::glyphs});
+	const auto rect_at = last_of(draws, {lge::draw_kind::rect});
+
+	REQUIRE(panel_at >= 0);
+	REQUIRE(panel_at < label_at);
+	REQUIRE(label_at < rect_at);
+}
+
+TEST_CASE("null backend: label size is deterministic", "[null_backend]") {
+	auto backend = lge::null_backend::create();
+
+	REQUIRE(backend.renderer_ptr->get_label_size({}, "abcd", 10) == glm::vec2{20.F, 10.F});
+	REQUIRE(backend.renderer_ptr->get_label_size({}, "ab\nabcdef", 10) == glm::vec2{30.F, 20.F});
+}
+
+TEST_CASE("null backend: missing files fail to load", "[null_backend]") {
+	auto backend = lge::null_backend::create();
+
+	REQUIRE_FALSE(backend.resource_manager_ptr->load_texture("does/not/exist.png").has_value());
+	REQUIRE_FALSE(backend.resource_manager_ptr->load_sprite_sheet("does/not/exist.json").has_value());
+}
+
+TEST_CASE("null backend: fixed timestep", "[null_backend][frame_pacing]") {
+	SECTION("without it the simulation steps once per frame with the frame time") {
+		headless_app application;
+		must(application.run_for(8));
+		REQUIRE(application.frames == 8);
+		REQUIRE(application.simulation_steps() == 1);
+	}
+
+	SECTION("frame time is accumulated into fixed steps") {
+		fixed_step_app application;
+		must(application.run_for(8));
+		REQUIRE(application.frames == 10);
+		REQUIRE(application.elapsed == Catch::Approx(1.875F));
+		REQUIRE(application.recorded().frame_count() == 8);
+	}
+
+	SECTION("a frame reports the steps it ran") {
+		fixed_step_app application;
+		must(application.run_for(3));
+		REQUIRE(application.simulation_steps() == 2);
+	}
+
+	SECTION("a frame that runs no step keeps its presses for the next step") {
+		// 0.375s steps run 0, 1, 1 and 0 times on 0.25s frames
+		edge_app application{0.375F};
+		must(application.run_for(4));
+		REQUIRE(application.frames == 2);
+		REQUIRE(application.presses == 1);
+		REQUIRE(application.releases == 1);
+		REQUIRE(application.pressed_on_step == 1);
+	}
+
+	SECTION("a frame that runs several steps sees a press only on the first") {
+		// 0.125s steps run twice every 0.25s frame
+		edge_app application{0.125F};
+		must(application.run_for(2));
+		REQUIRE(application.frames == 4);
+		REQUIRE(application.presses == 1);
+		REQUIRE(application.releases == 1);
+		REQUIRE(application.pressed_on_step == 1);
+	}
+
+	SECTION("steps a frame may catch up on are capped") {
+		fixed_step_app application{1};
+		must(application.run_for(3));
+		REQUIRE(application.frames == 3);
+		REQUIRE(application.simulation_steps() == 1);
+	}
+}
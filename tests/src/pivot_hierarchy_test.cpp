@@ -21,7 +21,7 @@ namespace {
 constexpr auto tolerance = 1e-3F;
 
 struct pivot_hierarchy_fixture {
-	lge::backend backend{lge::raylib_backend::create()};
+	lge::backend backend{lge::null_backend::create()};
 	lge::dispatcher dispatcher{};
 	entt::registry world{};
 	lge::context ctx{
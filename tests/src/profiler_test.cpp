@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/profiler.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <string>
+
+TEST_CASE("profiler: ring of recent frames", "[profiler]") {
+	lge::profiler profiler{4};
+	const auto update = profiler.intern("update");
+
+	SECTION("interning the same name returns the same id") {
+		REQUIRE(profiler.intern("update") == update);
+		REQUIRE(profiler.name_of(update) == "update");
+	}
+
+	SECTION("scopes record one sample each") {
+		profiler.begin_frame();
+		{
+			const lge::profiler::scope scope{&profiler, update, lge::profiler::category::system};
+		}
+		const auto samples = profiler.snapshot();
+		REQUIRE(samples.size() == 1);
+		REQUIRE(samples.front().name == update);
+		REQUIRE(samples.front().kind == lge::profiler::category::system);
+		REQUIRE(samples.front().frame == 1);
+	}
+
+	SECTION("only the last frames are kept") {
+		for(std::size_t frame = 0; frame < 10; ++frame) {
+			profiler.begin_frame();
+			profiler.record(update, lge::profiler::category::system, 0, 1);
+		}
+		const auto samples = profiler.snapshot();
+		REQUIRE(samples.size() == 4);
+		REQUIRE(samples.front().frame == 7);
+		REQUIRE(samples.back().frame == 10);
+	}
+
+	SECTION("a disabled profiler records nothing") {
+		profiler.set_frame_capacity(0);
+		profiler.begin_frame();
+		{
+			const lge::profiler::scope scope{&profiler, update, lge::profiler::category::system};
+		}
+		REQUIRE(profiler.snapshot().empty());
+	}
+}
+
+TEST_CASE("profiler: chrome trace export", "[profiler]") {
+	lge::profiler profiler{2};
+	const auto name = profiler.intern(R"(lge::"quoted")");
+
+	profiler.begin_frame();
+	profiler.record(name, lge::profiler::category::phase, 1000, 3500);
+
+	const auto trace = profiler.to_chrome_trace();
+	REQUIRE(trace.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+	REQUIRE(trace.find(R"("name":"lge::\"quoted\"")") != std::string::npos);
+	REQUIRE(trace.find(R"("cat":"phase","ph":"X","ts":1.000,"dur":2.500)") != std::string::npos);
+	REQUIRE(trace.ends_with("]}"));
+}
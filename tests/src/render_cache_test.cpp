@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/app/app.hpp>
+#include <lge/components/hierarchy.hpp>
+#include <lge/components/label.hpp>
+#include <lge/components/placement.hpp>
+#include <lge/components/render_cache.hpp>
+#include <lge/components/shapes.hpp>
+#include <lge/core/result.hpp>
+#include <lge/interface/draw_list.hpp>
+#include <lge/internal/null/null_backend.hpp>
+#include <lge/internal/null/null_renderer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <entity/fwd.hpp>
+#include <entt/entt.hpp>
+#include <glm/ext/vector_float2.hpp>
+
+// =============================================================================
+// Test app
+// =============================================================================
+
+namespace {
+
+enum class change : std::uint8_t { none, text, uncache, move, scale };
+
+// a cached rect with a label child, changed on the third frame, or moved on every frame from then on
+class cached_app: public lge::app {
+public:
+	explicit cached_app(const change on_third_frame): app(lge::null_backend::create()), change_{on_third_frame} {}
+
+	auto update(const float /*dt*/) -> lge::result<> override {
+		if(++frames_ == 3) {
+			if(change_ == change::text) {
+				ctx.world.get<lge::label>(caption_).text = "options";
+			} else if(change_ == change::uncache) {
+				ctx.world.remove<lge::render_cache>(root_);
+			} else if(change_ == change::scale) {
+				ctx.world.get<lge::placement>(root_).scale = {2.F, 2.F};
+			}
+		}
+		if(frames_ >= 3 && change_ == change::move) {
+			ctx.world.get<lge::placement>(root_).position += glm::vec2{0.5F, 0.25F};
+		}
+		return true;
+	}
+
+	[[nodiscard]] auto recorded() const -> const lge::null_renderer & {
+		return dynamic_cast<const lge::null_renderer &>(ctx.render);
+	}
+
+protected:
+	auto init() -> lge::result<> override {
+		if(const auto err = app::init().unwrap(); err) [[unlikely]] {
+			return lge::error("failed to init cached app", *err);
+		}
+		root_ = ctx.world.create();
+		ctx.world.emplace<lge::placement>(root_, lge::placement{10.F, 20.F});
+		ctx.world.emplace<lge::rect>(root_, lge::rect{.size = {64.F, 32.F}});
+		ctx.world.emplace<lge::render_cache>(root_);
+
+		caption_ = ctx.world.create();
+		ctx.world.emplace<lge::placement>(caption_, lge::placement{});
+		ctx.world.emplace<lge::label>(caption_, lge::label{.text = "play", .size = 10.F});
+		lge::attach(ctx.world, root_, caption_);
+		return true;
+	}
+
+private:
+	change change_;
+	std::size_t frames_ = 0;
+	entt::entity root_{entt::null};
+	entt::entity caption_{entt::null};
+};
+
+} // namespace
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+TEST_CASE("render cache: a static subtree is drawn once", "[render][render_cache]") {
+	cached_app application{change::none};
+	must(application.run_for(6));
+
+	REQUIRE(application.recorded().cache_render_count() == 1);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::cache) == 1);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::rect) == 0);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::glyphs) == 0);
+}
+
+TEST_CASE("render cache: a change in the subtree draws it again", "[render][render_cache]") {
+	cached_app application{change::text};
+	must(application.run_for(6));
+
+	REQUIRE(application.recorded().cache_render_count() == 2);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::cache) == 1);
+}
+
+TEST_CASE("render cache: moving the root moves the texture without drawing it again", "[render][render_cache]") {
+	cached_app application{change::move};
+	must(application.run_for(6));
+
+	REQUIRE(application.recorded().cache_render_count() == 1);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::cache) == 1);
+}
+
+TEST_CASE("render cache: scaling the root draws it again", "[render][render_cache]") {
+	cached_app application{change::scale};
+	must(application.run_for(6));
+
+	REQUIRE(application.recorded().cache_render_count() == 2);
+}
+
+TEST_CASE("render cache: removing the component releases the cache", "[render][render_cache]") {
+	cached_app application{change::uncache};
+	must(application.run_for(6));
+
+	REQUIRE(application.recorded().cache_render_count() == 1);
+	REQUIRE(application.recorded().cache_count() == 0);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::cache) == 0);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::rect) == 1);
+	REQUIRE(application.recorded().recorded_count(lge::draw_kind::glyphs) == 1);
+}
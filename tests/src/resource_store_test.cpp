@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/core/result.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/resource_manager/resource_store.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+
+namespace {
+
+struct test_resource {
+	[[nodiscard]] auto load(const std::string_view uri) -> lge::result<> {
+		if(uri == "missing.png") {
+			return lge::error("no such file");
+		}
+		name = uri;
+		return true;
+	}
+
+	std::string name;
+};
+
+using test_store = lge::resource_store<test_resource, lge::texture_handle>;
+
+auto must_load(test_store &store, const std::string_view uri) -> lge::texture_handle {
+	lge::texture_handle handle;
+	REQUIRE(!store.load(uri).unwrap(handle).has_value());
+	return handle;
+}
+
+auto name_of(const test_store &store, const lge::texture_handle handle) -> std::string {
+	const test_resource *resource = nullptr;
+	REQUIRE(!store.get(handle).unwrap(resource).has_value());
+	return resource->name;
+}
+
+} // namespace
+
+TEST_CASE("resource store: handles", "[resource_store]") {
+	test_store store;
+
+	SECTION("a loaded resource is found by its handle") {
+		const auto handle = must_load(store, "player.png");
+		REQUIRE(handle.is_valid());
+		REQUIRE(handle.raw() != 0);
+		REQUIRE(name_of(store, handle) == "player.png");
+	}
+
+	SECTION("loading the same uri twice shares the resource") {
+		const auto first = must_load(store, "player.png");
+		const auto second = must_load(store, "player.png");
+		REQUIRE(first == second);
+
+		REQUIRE(!store.unload(first).unwrap().has_value());
+		REQUIRE(name_of(store, second) == "player.png");
+	}
+
+	SECTION("a failed load hands out no handle") {
+		REQUIRE(store.load("missing.png").has_error());
+		REQUIRE(store.get(lge::invalid_texture).has_error());
+	}
+
+	SECTION("the null handle is not found") {
+		must_load(store, "player.png");
+		REQUIRE(store.get(lge::invalid_texture).has_error());
+	}
+}
+
+TEST_CASE("resource store: stale handles", "[resource_store]") {
+	test_store store;
+
+	SECTION("a handle of an unloaded resource is not found") {
+		const auto handle = must_load(store, "player.png");
+		REQUIRE(!store.unload(handle).unwrap().has_value());
+		REQUIRE(store.get(handle).has_error());
+		REQUIRE(store.unload(handle).has_error());
+	}
+
+	SECTION("a stale handle does not reach the resource reusing its slot") {
+		const auto stale = must_load(store, "player.png");
+		REQUIRE(!store.unload(stale).unwrap().has_value());
+
+		const auto reused = must_load(store, "enemy.png");
+		REQUIRE(reused != stale);
+		REQUIRE(store.get(stale).has_error());
+		REQUIRE(name_of(store, reused) == "enemy.png");
+	}
+
+	SECTION("an unloaded uri loads again under a new handle") {
+		const auto first = must_load(store, "player.png");
+		REQUIRE(!store.unload(first).unwrap().has_value());
+
+		const auto again = must_load(store, "player.png");
+		REQUIRE(again != first);
+		REQUIRE(name_of(store, again) == "player.png");
+	}
+
+	SECTION("for_each visits only loaded resources") {
+		const auto player = must_load(store, "player.png");
+		must_load(store, "enemy.png");
+		REQUIRE(!store.unload(player).unwrap().has_value());
+
+		std::string visited;
+		store.for_each([&visited](const test_resource &r) -> void { visited += r.name; });
+		REQUIRE(visited == "enemy.png");
+	}
+}
+
+TEST_CASE("resource store: loading elsewhere", "[resource_store][async_loading]") {
+	test_store store;
+
+	test_store::reservation reserved;
+	REQUIRE(!store.reserve("player.png").unwrap(reserved).has_value());
+	REQUIRE(reserved.is_new);
+	const auto handle = reserved.key;
+
+	SECTION("a reserved key is pending until it is finished") {
+		REQUIRE(store.state(handle) == lge::load_state::pending);
+		REQUIRE(store.get(handle).has_error());
+
+		REQUIRE(!store.finish(handle, "player.png").unwrap().has_value());
+		REQUIRE(store.state(handle) == lge::load_state::ready);
+		REQUIRE(name_of(store, handle) == "player.png");
+	}
+
+	SECTION("reserving the same uri shares the pending key") {
+		REQUIRE(!store.reserve("player.png").unwrap(reserved).has_value());
+		REQUIRE_FALSE(reserved.is_new);
+		REQUIRE(reserved.key == handle);
+		REQUIRE(store.state(handle) == lge::load_state::pending);
+	}
+
+	SECTION("loading a pending uri finishes it, dropping the work left") {
+		REQUIRE(must_load(store, "player.png") == handle);
+		REQUIRE(store.state(handle) == lge::load_state::ready);
+		REQUIRE(name_of(store, handle) == "player.png");
+		REQUIRE_FALSE(store.is_pending(handle));
+
+		// both the reservation and the load hold it
+		REQUIRE(!store.unload(handle).unwrap().has_value());
+		REQUIRE(name_of(store, handle) == "player.png");
+	}
+
+	SECTION("a failed load keeps its key, reporting the failure") {
+		store.fail(handle, lge::error("no such file"));
+		REQUIRE(store.state(handle) == lge::load_state::failed);
+		REQUIRE(store.get(handle).has_error());
+		REQUIRE(store.finish(handle, "player.png").has_error());
+		REQUIRE(store.load("player.png").has_error());
+
+		REQUIRE(!store.unload(handle).unwrap().has_value());
+		REQUIRE_FALSE(store.is_pending(handle));
+	}
+
+	SECTION("an unloaded reservation is no longer pending, so its work is dropped") {
+		REQUIRE(!store.unload(handle).unwrap().has_value());
+		REQUIRE_FALSE(store.is_pending(handle));
+		REQUIRE(store.finish(handle, "player.png").has_error());
+		REQUIRE(store.state(handle) == lge::load_state::failed);
+	}
+}
@@ -6,6 +6,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <optional>
 #include <string>
+#include <variant>
+#include <vector>
 
 // =============================================================================
 // result<>
@@ -96,4 +98,52 @@ TEST_CASE("error: to_string with chain", "[error]") {
 		REQUIRE(str.find("higher level") != std::string::npos);
 		REQUIRE(str.find("caused by") == std::string::npos);
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("result: values are not copied", "[result]") {
+	SECTION("unwrap moves the value out of a temporary") {
+		auto make = []() -> lge::result<std::vector<int>> { return std::vector<int>(1000, 7); };
+		std::vector<int> value;
+		REQUIRE(!make().unwrap(value).has_value());
+		REQUIRE(value.size() == 1000);
+	}
+
+	SECTION("get_value references the value of a kept result") {
+		const lge::result<std::vector<int>> r = std::vector<int>{1, 2, 3};
+		const auto &value = r.get_value();
+		REQUIRE(&value == &std::get<std::vector<int>>(r));
+	}
+
+	SECTION("unwrap of a kept result leaves its value in place") {
+		const lge::result<std::string> r = std::string{"a value too long for the small string buffer"};
+		std::string value;
+		REQUIRE(!r.unwrap(value).has_value());
+		REQUIRE(value == r.get_value());
+	}
+}
+
+TEST_CASE("error: chains share their causes", "[error]") {
+	SECTION("every level of a deep chain is reported, newest first") {
+		lge::error err("level 0");
+		for(auto i = 1; i < 100; ++i) {
+			err = lge::error("level " + std::to_string(i), err);
+		}
+
+		const auto str = err.to_string();
+		REQUIRE(err.get_message() == "level 99");
+		REQUIRE(str.find("level 99") < str.find("level 0 "));
+		REQUIRE(str.find("level 0 ") != std::string::npos);
+	}
+
+	SECTION("wrapping an error leaves it unchanged") {
+		const lge::error root("root cause");
+		const lge::error chained("higher level", root);
+		REQUIRE(root.get_message() == "root cause");
+		REQUIRE(root.to_string().find("higher level") == std::string::npos);
+	}
+
+	SECTION("copies report the same chain") {
+		const lge::error chained("higher level", lge::error("root cause"));
+		const auto copy = chained; // NOLINT(performance-unnecessary-copy-initialization)
+		REQUIRE(copy.to_string() == chained.to_string());
+	}
+}
@@ -3,8 +3,11 @@
 
 #include <lge/core/colors.hpp>
 #include <lge/internal/text/rich_text.hpp>
+#include <lge/text/text_segment.hpp>
 
 #include <catch2/catch_test_macros.hpp>
+#include <string_view>
+#include <vector>
 
 // =============================================================================
 // has_rich_tags
@@ -86,9 +89,10 @@ TEST_CASE("rich_text: parse_rich_text produces correct segments", "[rich_text]")
 	constexpr auto default_color = lge::colors::white;
 
 	SECTION("plain text produces one segment with default color") {
-		const auto segs = lge::parse_rich_text("hello", default_color);
+		const std::string_view text = "hello";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "hello");
+		REQUIRE(segs[0].view(text) == "hello");
 		REQUIRE(segs[0].segment_color == default_color);
 	}
 
@@ -97,40 +101,45 @@ TEST_CASE("rich_text: parse_rich_text produces correct segments", "[rich_text]")
 	}
 
 	SECTION("reset tag with no prior color uses default") {
-		const auto segs = lge::parse_rich_text("{#}hello", default_color);
+		const std::string_view text = "{#}hello";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "hello");
+		REQUIRE(segs[0].view(text) == "hello");
 		REQUIRE(segs[0].segment_color == default_color);
 	}
 
 	SECTION("rgb tag produces correct color") {
-		const auto segs = lge::parse_rich_text("{#FF0000}red", default_color);
+		const std::string_view text = "{#FF0000}red";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "red");
+		REQUIRE(segs[0].view(text) == "red");
 		REQUIRE(segs[0].segment_color == lge::color::from_hex(0xFF0000FF));
 	}
 
 	SECTION("rgba tag produces correct color with alpha") {
-		const auto segs = lge::parse_rich_text("{#FF00001A}faint", default_color);
+		const std::string_view text = "{#FF00001A}faint";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "faint");
+		REQUIRE(segs[0].view(text) == "faint");
 		REQUIRE(segs[0].segment_color == lge::color::from_hex(0xFF00001A));
 	}
 
 	SECTION("text before tag is first segment with default color") {
-		const auto segs = lge::parse_rich_text("normal {#FF0000}red", default_color);
+		const std::string_view text = "normal {#FF0000}red";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 2);
-		REQUIRE(segs[0].text == "normal ");
+		REQUIRE(segs[0].view(text) == "normal ");
 		REQUIRE(segs[0].segment_color == default_color);
-		REQUIRE(segs[1].text == "red");
+		REQUIRE(segs[1].view(text) == "red");
 		REQUIRE(segs[1].segment_color == lge::color::from_hex(0xFF0000FF));
 	}
 
 	SECTION("reset tag after color restores default") {
-		const auto segs = lge::parse_rich_text("{#FF0000}red{#}normal", default_color);
+		const std::string_view text = "{#FF0000}red{#}normal";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 2);
 		REQUIRE(segs[0].segment_color == lge::color::from_hex(0xFF0000FF));
-		REQUIRE(segs[1].text == "normal");
+		REQUIRE(segs[1].view(text) == "normal");
 		REQUIRE(segs[1].segment_color == default_color);
 	}
 
@@ -146,37 +155,81 @@ TEST_CASE("rich_text: parse_rich_text produces correct segments", "[rich_text]")
 	}
 
 	SECTION("malformed tag (wrong length) is treated as literal text") {
-		const auto segs = lge::parse_rich_text("{#FF}bad", default_color);
+		const std::string_view text = "{#FF}bad";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "{#FF}bad");
+		REQUIRE(segs[0].view(text) == "{#FF}bad");
 		REQUIRE(segs[0].segment_color == default_color);
 	}
 
 	SECTION("malformed tag (invalid hex) is treated as literal text") {
-		const auto segs = lge::parse_rich_text("{#ZZZZZZ}bad", default_color);
+		const std::string_view text = "{#ZZZZZZ}bad";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "{#ZZZZZZ}bad");
+		REQUIRE(segs[0].view(text) == "{#ZZZZZZ}bad");
 		REQUIRE(segs[0].segment_color == default_color);
 	}
 
 	SECTION("there is no tag nesting — reset always goes to default") {
 		// {#FF0000}red {#00FF00}green {#} — the reset goes to default, not back to red
-		const auto segs = lge::parse_rich_text("{#FF0000}red {#00FF00}green {#}back", default_color);
+		const std::string_view text = "{#FF0000}red {#00FF00}green {#}back";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 3);
 		REQUIRE(segs[2].segment_color == default_color);
-		REQUIRE(segs[2].text == "back");
+		REQUIRE(segs[2].view(text) == "back");
 	}
 
 	SECTION("multiline text in a single segment is preserved") {
-		const auto segs = lge::parse_rich_text("line1\nline2", default_color);
+		const std::string_view text = "line1\nline2";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 1);
-		REQUIRE(segs[0].text == "line1\nline2");
+		REQUIRE(segs[0].view(text) == "line1\nline2");
 	}
 
 	SECTION("multiline text across multiple color segments is preserved") {
-		const auto segs = lge::parse_rich_text("{#FF0000}line1\n{#}line2", default_color);
+		const std::string_view text = "{#FF0000}line1\n{#}line2";
+		const auto segs = lge::parse_rich_text(text, default_color);
+		REQUIRE(segs.size() == 2);
+		REQUIRE(segs[0].view(text) == "line1\n");
+		REQUIRE(segs[1].view(text) == "line2");
+	}
+
+	SECTION("segments are spans of the parsed text") {
+		const std::string_view text = "ab{#FF0000}cd";
+		const auto segs = lge::parse_rich_text(text, default_color);
 		REQUIRE(segs.size() == 2);
-		REQUIRE(segs[0].text == "line1\n");
-		REQUIRE(segs[1].text == "line2");
+		REQUIRE(segs[0].offset == 0);
+		REQUIRE(segs[0].length == 2);
+		REQUIRE(segs[1].offset == 11);
+		REQUIRE(segs[1].length == 2);
 	}
-}
\ No newline at end of file
+
+	SECTION("parsing into a vector replaces what it held") {
+		std::vector<lge::text_segment> segs;
+		lge::parse_rich_text("{#FF0000}red {#}normal", default_color, segs);
+		REQUIRE(segs.size() == 2);
+		lge::parse_rich_text("plain", default_color, segs);
+		REQUIRE(segs.size() == 1);
+		REQUIRE(segs[0].segment_color == default_color);
+	}
+}
+
+// =============================================================================
+// Plain runs
+// =============================================================================
+
+TEST_CASE("rich_text: plain text is walked without stripping it", "[rich_text]") {
+	SECTION("runs are the text between tags") {
+		std::vector<std::string_view> runs;
+		lge::for_each_plain_run("a{#FF0000}bc{#}{#00FF00}d{#FF}e",
+								[&runs](const std::string_view run) -> void { runs.push_back(run); });
+		REQUIRE(runs == std::vector<std::string_view>{"a", "bc", "d{#FF}e"});
+	}
+
+	SECTION("stripped length matches the stripped text") {
+		for(const std::string_view text:
+			{"", "hello", "{#}", "a{#FF0000}b{#}c", "{#FF}text", "{#FF0000}line1\n{#}line2"}) {
+			REQUIRE(lge::stripped_length(text) == lge::strip_rich_tags(text).size());
+		}
+	}
+}
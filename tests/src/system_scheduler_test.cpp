@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/app/app.hpp>
+#include <lge/app/app_config.hpp>
+#include <lge/app/context.hpp>
+#include <lge/components/hidden.hpp>
+#include <lge/components/hierarchy.hpp>
+#include <lge/components/order.hpp>
+#include <lge/components/placement.hpp>
+#include <lge/components/shapes.hpp>
+#include <lge/core/result.hpp>
+#include <lge/internal/components/bounds.hpp>
+#include <lge/internal/components/effective_hidden.hpp>
+#include <lge/internal/components/render_order.hpp>
+#include <lge/internal/components/transform.hpp>
+#include <lge/internal/null/null_backend.hpp>
+#include <lge/internal/scheduler/system_scheduler.hpp>
+#include <lge/internal/scheduler/thread_pool.hpp>
+#include <lge/systems/system.hpp>
+
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct position {
+	float x = 0.F;
+};
+
+struct velocity {
+	float x = 0.F;
+};
+
+struct health {
+	int value = 0;
+};
+
+// does nothing but declare the access it was given
+class declared_system: public lge::system {
+public:
+	declared_system(const lge::phase p,
+					lge::context &ctx,
+					lge::system_access declared = lge::system_access::exclusive())
+		: system(p, ctx), declared_{std::move(declared)} {}
+
+	auto update(const float /*dt*/) -> lge::result<> override {
+		return true;
+	}
+
+	[[nodiscard]] auto access() const -> lge::system_access override {
+		return declared_;
+	}
+
+private:
+	lge::system_access declared_;
+};
+
+struct scheduler_fixture: system_fixture<declared_system> {
+	std::vector<std::unique_ptr<lge::system>> systems;
+	lge::system_scheduler scheduler;
+
+	auto add(const lge::phase p, lge::system_access declared) -> void {
+		systems.push_back(std::make_unique<declared_system>(p, ctx, std::move(declared)));
+	}
+
+	[[nodiscard]] auto batches(const lge::phase p) -> std::vector<std::vector<std::size_t>> {
+		scheduler.build(systems, world);
+		const auto span = scheduler.batches_of(p);
+		return {span.begin(), span.end()};
+	}
+};
+
+// builds the same tree on every app, so their results can be compared
+class hierarchy_app: public lge::app {
+public:
+	explicit hierarchy_app(const bool parallel): app(lge::null_backend::create()), parallel_{parallel} {}
+
+	auto configure() -> lge::app_config override {
+		auto config = app::configure();
+		config.parallel_systems = parallel_;
+		config.worker_threads = 3;
+		return config;
+	}
+
+	[[nodiscard]] auto world() const -> const entt::registry & {
+		return ctx.world;
+	}
+
+	std::vector<entt::entity> nodes;
+
+protected:
+	auto init() -> lge::result<> override {
+		if(const auto err = app::init().unwrap(); err) [[unlikely]] {
+			return lge::error("failed to init hierarchy app", *err);
+		}
+
+		constexpr auto roots = 16;
+		constexpr auto depth = 4;
+		for(auto r = 0; r < roots; ++r) {
+			auto current = ctx.world.create();
+			ctx.world.emplace<lge::placement>(current, lge::placement{static_cast<float>(r) * 10.F, 5.F, 15.F});
+			ctx.world.emplace<lge::rect>(current, lge::rect{.size = {8.F, 4.F}});
+			ctx.world.emplace<lge::order>(current, lge::order{.layer = r % 3, .index = r});
+			if(r % 5 == 0) {
+				ctx.world.emplace<lge::hidden>(current);
+			}
+			nodes.push_back(current);
+
+			for(auto d = 0; d < depth; ++d) {
+				const auto child = add_child(ctx.world, current, lge::placement{3.F, static_cast<float>(d), 10.F});
+				ctx.world.emplace<lge::rect>(child, lge::rect{.size = {2.F, 2.F}});
+				nodes.push_back(child);
+				current = child;
+			}
+		}
+		return true;
+	}
+
+private:
+	bool parallel_;
+};
+
+} // namespace
+
+// =============================================================================
+// Batches
+// =============================================================================
+
+TEST_CASE("system scheduler: batches from declared access", "[system_scheduler]") {
+	scheduler_fixture f;
+
+	SECTION("disjoint systems share a batch") {
+		f.add(lge::phase::global_update, lge::system_access{}.write<position>());
+		f.add(lge::phase::global_update, lge::system_access{}.write<health>());
+		REQUIRE(f.batches(lge::phase::global_update) == std::vector<std::vector<std::size_t>>{{0, 1}});
+	}
+
+	SECTION("readers of the same component share a batch") {
+		f.add(lge::phase::global_update, lge::system_access{}.read<position>().write<velocity>());
+		f.add(lge::phase::global_update, lge::system_access{}.read<position>().write<health>());
+		REQUIRE(f.batches(lge::phase::global_update) == std::vector<std::vector<std::size_t>>{{0, 1}});
+	}
+
+	SECTION("a reader runs after an earlier writer") {
+		f.add(lge::phase::global_update, lge::system_access{}.write<position>());
+		f.add(lge::phase::global_update, lge::system_access{}.read<position>().write<velocity>());
+		f.add(lge::phase::global_update, lge::system_access{}.write<health>());
+		REQUIRE(f.batches(lge::phase::global_update) == std::vector<std::vector<std::size_t>>{{0, 2}, {1}});
+	}
+
+	SECTION("exclusive systems keep everything around them in order") {
+		f.add(lge::phase::global_update, lge::system_access{}.write<position>());
+		f.add(lge::phase::global_update, lge::system_access::exclusive());
+		f.add(lge::phase::global_update, lge::system_access{}.write<health>());
+		REQUIRE(f.batches(lge::phase::global_update) == std::vector<std::vector<std::size_t>>{{0}, {1}, {2}});
+	}
+
+	SECTION("systems of other phases never conflict") {
+		f.add(lge::phase::global_update, lge::system_access::exclusive());
+		f.add(lge::phase::render, lge::system_access::exclusive());
+		REQUIRE(f.batches(lge::phase::global_update) == std::vector<std::vector<std::size_t>>{{0}});
+		REQUIRE(f.batches(lge::phase::render) == std::vector<std::vector<std::size_t>>{{1}});
+	}
+
+	SECTION("declared storages exist before any system runs") {
+		f.add(lge::phase::global_update, lge::system_access{}.read<velocity>().write<position>());
+		std::ignore = f.batches(lge::phase::global_update);
+		REQUIRE(std::as_const(f.world).storage<position>() != nullptr);
+		REQUIRE(std::as_const(f.world).storage<velocity>() != nullptr);
+	}
+}
+
+// =============================================================================
+// Thread pool
+// =============================================================================
+
+TEST_CASE("thread pool: runs every task once", "[system_scheduler]") {
+	lge::thread_pool pool{3};
+	std::vector<std::atomic<int>> runs(64);
+
+	for(auto batch = 0; batch < 10; ++batch) {
+		pool.run(runs.size(), [&runs](const std::size_t i) -> void { runs[i].fetch_add(1); });
+	}
+
+	for(const auto &count: runs) {
+		REQUIRE(count.load() == 10);
+	}
+}
+
+// =============================================================================
+// Parallel and serial runs
+// =============================================================================
+
+TEST_CASE("system scheduler: parallel runs match serial ones", "[system_scheduler]") {
+	hierarchy_app serial{false};
+	hierarchy_app parallel{true};
+
+	must(serial.run_for(4));
+	must(parallel.run_for(4));
+
+	REQUIRE(serial.nodes.size() == parallel.nodes.size());
+	for(std::size_t i = 0; i < serial.nodes.size(); ++i) {
+		const auto &a = serial.world();
+		const auto &b = parallel.world();
+		const auto ea = serial.nodes[i];
+		const auto eb = parallel.nodes[i];
+
+		REQUIRE(a.get<lge::transform>(ea).origin == b.get<lge::transform>(eb).origin);
+		REQUIRE(a.get<lge::render_order>(ea).layer == b.get<lge::render_order>(eb).layer);
+		REQUIRE(a.get<lge::render_order>(ea).index == b.get<lge::render_order>(eb).index);
+		REQUIRE(a.all_of<lge::effective_hidden>(ea) == b.all_of<lge::effective_hidden>(eb));
+		REQUIRE(a.get<lge::bounds>(ea).p0 == b.get<lge::bounds>(eb).p0);
+		REQUIRE(a.get<lge::bounds>(ea).p2 == b.get<lge::bounds>(eb).p2);
+	}
+}
@@ -10,14 +10,14 @@
 #include <lge/dispatcher/dispatcher.hpp>
 #include <lge/internal/components/metrics.hpp>
 #include <lge/internal/components/transform.hpp>
-#include <lge/internal/raylib/raylib_backend.hpp>
+#include <lge/internal/null/null_backend.hpp>
 #include <lge/scene/scene_manager.hpp>
 #include <lge/systems/system.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include <entt/entt.hpp>
+#include <glm/common.hpp>
 #include <glm/ext/vector_float2.hpp>
-#include <glm/geometric.hpp>
 #include <string>
 #include <vector>
 
@@ -50,7 +50,7 @@ inline auto must(const lge::result<> &res) -> void {
 // System_T must be constructible as: System_T{lge::phase, lge::context&}.
 template<typename System_T>
 struct system_fixture {
-	lge::backend backend{lge::raylib_backend::create()};
+	lge::backend backend{lge::null_backend::create()};
 	lge::dispatcher dispatcher{};
 	entt::registry world{};
 	lge::context ctx{
@@ -66,7 +66,7 @@ struct system_fixture {
 
 // Fixture for tests that exercise the scene manager.
 struct scene_fixture {
-	lge::backend backend{lge::raylib_backend::create()};
+	lge::backend backend{lge::null_backend::create()};
 	lge::dispatcher dispatcher{};
 	entt::registry world{};
 	lge::context ctx{
@@ -125,14 +125,12 @@ struct scene_fixture {
 // Transform inspection helpers
 // =============================================================================
 
-// Extracts the world-space position from a transform component.
+// Extracts the world-space position of the local origin from a transform component.
 [[nodiscard]] inline auto world_pos(const entt::registry &world, const entt::entity e) -> glm::vec2 {
-	const auto &mat = world.get<lge::transform>(e).world;
-	return {mat[2][0], mat[2][1]};
+	return world.get<lge::transform>(e).origin;
 }
 
-// Extracts the world-space scale from a transform component.
+// Extracts the world-space scale magnitude from a transform component.
 [[nodiscard]] inline auto world_scale(const entt::registry &world, const entt::entity e) -> glm::vec2 {
-	const auto &mat = world.get<lge::transform>(e).world;
-	return {glm::length(glm::vec2{mat[0][0], mat[0][1]}), glm::length(glm::vec2{mat[1][0], mat[1][1]})};
+	return glm::abs(world.get<lge::transform>(e).scale);
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <lge/components/button.hpp>
+#include <lge/interface/resources.hpp>
+#include <lge/internal/components/text_metrics.hpp>
+#include <lge/internal/systems/metrics_system.hpp>
+#include <lge/internal/text/text_metrics_cache.hpp>
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <glm/ext/vector_float2.hpp>
+
+// =============================================================================
+// Cache
+// =============================================================================
+
+TEST_CASE("text metrics cache: least recently used eviction", "[text_metrics]") {
+	lge::text_metrics_cache cache{2};
+	const auto font = lge::font_handle::from_id(1);
+
+	SECTION("a measured text is found again") {
+		cache.insert(font, 10, "play", {20.F, 10.F});
+		const auto *found = cache.find(font, 10, "play");
+		REQUIRE(found != nullptr);
+		REQUIRE(*found == glm::vec2{20.F, 10.F});
+	}
+
+	SECTION("font, size and text are all part of the key") {
+		cache.insert(font, 10, "play", {20.F, 10.F});
+		REQUIRE(cache.find(font, 12, "play") == nullptr);
+		REQUIRE(cache.find(lge::font_handle::from_id(2), 10, "play") == nullptr);
+		REQUIRE(cache.find(font, 10, "quit") == nullptr);
+	}
+
+	SECTION("the least recently used text is evicted first") {
+		cache.insert(font, 10, "play", {20.F, 10.F});
+		cache.insert(font, 10, "options", {35.F, 10.F});
+		REQUIRE(cache.find(font, 10, "play") != nullptr);
+
+		cache.insert(font, 10, "quit", {20.F, 10.F});
+		REQUIRE(cache.size() == 2);
+		REQUIRE(cache.find(font, 10, "options") == nullptr);
+		REQUIRE(cache.find(font, 10, "play") != nullptr);
+		REQUIRE(cache.find(font, 10, "quit") != nullptr);
+	}
+
+	SECTION("inserting a known text replaces its size") {
+		cache.insert(font, 10, "play", {20.F, 10.F});
+		cache.insert(font, 10, "play", {25.F, 10.F});
+		REQUIRE(cache.size() == 1);
+		REQUIRE(*cache.find(font, 10, "play") == glm::vec2{25.F, 10.F});
+	}
+}
+
+// =============================================================================
+// Button text
+// =============================================================================
+
+TEST_CASE("text metrics: buttons keep their measured text", "[text_metrics][metrics]") {
+	system_fixture<lge::metrics_system> f;
+	const auto e = f.world.create();
+	f.world.emplace<lge::button>(e, lge::button{.size = {100.F, 40.F}, .text = "play", .text_size = 10.F});
+
+	must(f.system.update(0.F));
+
+	SECTION("the text is measured with the button") {
+		REQUIRE(f.world.get<lge::text_metrics>(e).size == glm::vec2{20.F, 10.F});
+	}
+
+	SECTION("a new text is measured again") {
+		f.world.get<lge::button>(e).text = "options";
+		must(f.system.update(0.F));
+		REQUIRE(f.world.get<lge::text_metrics>(e).size == glm::vec2{35.F, 10.F});
+	}
+
+	SECTION("a new text size is measured again") {
+		f.world.get<lge::button>(e).text_size = 20.F;
+		must(f.system.update(0.F));
+		REQUIRE(f.world.get<lge::text_metrics>(e).size == glm::vec2{40.F, 20.F});
+	}
+}
@@ -3,6 +3,7 @@
 
 #include <lge/components/placement.hpp>
 #include <lge/internal/components/transform.hpp>
+#include <lge/internal/scheduler/thread_pool.hpp>
 #include <lge/internal/systems/transform_system.hpp>
 
 #include "test_helpers.hpp"
@@ -10,8 +11,11 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
+#include <cstddef>
+#include <entt/entt.hpp>
 #include <glm/trigonometric.hpp>
 #include <ranges>
+#include <vector>
 
 using Catch::Approx;
 
@@ -49,9 +53,9 @@ TEST_CASE("transform: root entity", "[transform]") {
 	SECTION("rotation is applied directly") {
 		const auto e = add_entity(f.world, lge::placement{0.F, 0.F, 45.F});
 		REQUIRE(!f.system.update(0.F).has_error());
-		const auto &mat = f.world.get<lge::transform>(e).world;
-		const float angle = glm::degrees(std::atan2(mat[0][1], mat[0][0]));
-		REQUIRE(angle == -45.F);
+		const auto &tf = f.world.get<lge::transform>(e);
+		REQUIRE(tf.rotation == 45.F);
+		REQUIRE(glm::degrees(std::atan2(tf.sin, tf.cos)) == Approx(45.F).margin(tolerance));
 	}
 
 	SECTION("negative scale does not produce NaN") {
@@ -300,4 +304,123 @@ TEST_CASE("transform: hierarchy mutation", "[transform][hierarchy]") {
 		REQUIRE(!f.system.update(0.F).has_error());
 		REQUIRE(world_pos(f.world, child).x == 110.F);
 	}
-}
\ No newline at end of file
+}
+
+// =============================================================================
+// Change tracking
+// =============================================================================
+
+TEST_CASE("transform: change tracking", "[transform][dirty]") {
+	fixture f;
+
+	SECTION("moving a root after the first update recomposes it") {
+		const auto e = add_entity(f.world, lge::placement{10.F, 0.F});
+		REQUIRE(!f.system.update(0.F).has_error());
+		f.world.get<lge::placement>(e).position.x = 30.F;
+		REQUIRE(!f.system.update(0.F).has_error());
+		REQUIRE(world_pos(f.world, e).x == 30.F);
+	}
+
+	SECTION("moving a parent recomposes unchanged descendants") {
+		const auto parent = add_entity(f.world, lge::placement{0.F, 0.F});
+		const auto child = add_child(f.world, parent, lge::placement{10.F, 0.F});
+		const auto grandchild = add_child(f.world, child, lge::placement{5.F, 0.F});
+		REQUIRE(!f.system.update(0.F).has_error());
+		f.world.get<lge::placement>(parent).position.x = 100.F;
+		REQUIRE(!f.system.update(0.F).has_error());
+		REQUIRE(world_pos(f.world, child).x == 110.F);
+		REQUIRE(world_pos(f.world, grandchild).x == 115.F);
+	}
+
+	SECTION("moving a child does not change its parent") {
+		const auto parent = add_entity(f.world, lge::placement{100.F, 0.F});
+		const auto child = add_child(f.world, parent, lge::placement{10.F, 0.F});
+		REQUIRE(!f.system.update(0.F).has_error());
+		f.world.get<lge::placement>(child).position.x = 20.F;
+		REQUIRE(!f.system.update(0.F).has_error());
+		REQUIRE(world_pos(f.world, parent).x == 100.F);
+		REQUIRE(world_pos(f.world, child).x == 120.F);
+	}
+
+	SECTION("changing metrics recomposes the pivot offset") {
+		const auto e =
+			add_entity(f.world, lge::placement{0.F, 0.F, 0.F, {1.F, 1.F}, lge::pivot::center}, {100.F, 50.F});
+		REQUIRE(!f.system.update(0.F).has_error());
+		f.world.get<lge::metrics>(e).size = {200.F, 100.F};
+		REQUIRE(!f.system.update(0.F).has_error());
+		const auto pos = world_pos(f.world, e);
+		REQUIRE(pos.x == -100.F);
+		REQUIRE(pos.y == -50.F);
+	}
+
+	SECTION("detached child is recomposed as a root") {
+		const auto parent = add_entity(f.world, lge::placement{100.F, 0.F});
+		const auto child = add_child(f.world, parent, lge::placement{10.F, 0.F});
+		REQUIRE(!f.system.update(0.F).has_error());
+		f.world.erase<lge::parent>(child);
+		REQUIRE(!f.system.update(0.F).has_error());
+		REQUIRE(world_pos(f.world, child).x == 10.F);
+	}
+}
+
+// =============================================================================
+// Parallel update
+// =============================================================================
+
+namespace {
+
+// loose entities plus small trees, enough of them to split the update across threads
+auto build_scene(entt::registry &world) -> std::vector<entt::entity> {
+	std::vector<entt::entity> nodes;
+	for(auto i = 0; i < 3000; ++i) {
+		const auto x = static_cast<float>(i);
+		nodes.push_back(add_entity(world, lge::placement{x, -x, x * 0.5F}, {4.F, 2.F}));
+
+		if(i % 3 == 0) {
+			const auto root = nodes.back();
+			const auto child = add_child(world, root, lge::placement{1.F, 2.F, 10.F, {2.F, 2.F}});
+			nodes.push_back(child);
+			nodes.push_back(add_child(world, child, lge::placement{3.F, 4.F, 20.F}));
+		}
+	}
+	return nodes;
+}
+
+} // namespace
+
+TEST_CASE("transform: parallel update matches serial", "[transform][parallel]") {
+	fixture serial;
+	fixture parallel;
+	parallel.world.ctx().emplace<lge::thread_pool>(3);
+
+	const auto serial_nodes = build_scene(serial.world);
+	const auto parallel_nodes = build_scene(parallel.world);
+
+	const auto require_same = [&]() -> void {
+		for(std::size_t i = 0; i < serial_nodes.size(); ++i) {
+			const auto &a = serial.world.get<lge::transform>(serial_nodes[i]);
+			const auto &b = parallel.world.get<lge::transform>(parallel_nodes[i]);
+			REQUIRE(a.origin == b.origin);
+			REQUIRE(a.scale == b.scale);
+			REQUIRE(a.rotation == b.rotation);
+		}
+	};
+
+	SECTION("first update adds every transform") {
+		must(serial.system.update(0.F));
+		must(parallel.system.update(0.F));
+		require_same();
+	}
+
+	SECTION("later updates replace the changed ones") {
+		must(serial.system.update(0.F));
+		must(parallel.system.update(0.F));
+		for(std::size_t i = 0; i < serial_nodes.size(); i += 7) {
+			serial.world.get<lge::placement>(serial_nodes[i]).rotation += 45.F;
+			parallel.world.get<lge::placement>(parallel_nodes[i]).rotation += 45.F;
+		}
+		must(serial.system.update(0.F));
+		must(parallel.system.update(0.F));
+		require_same();
+	}
+}